@@ -0,0 +1,118 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/bench_util.h
+ * Description: minimal timing helpers shared by the micro-benchmarks
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_BENCH_UTIL_H_INCLUDED
+#define NS_UTIL_BENCH_UTIL_H_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+namespace bench
+{
+/**
+ * @brief Prevent the optimiser from discarding a computed value.
+ *
+ * @tparam T_ type of the value
+ * @param value the value to keep alive
+ */
+template <typename T_> inline void doNotOptimize(T_ const &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Run a callable repeatedly and report the best throughput.
+ *
+ * @tparam Func_ callable type, invoked without arguments
+ * @param name label printed in the report
+ * @param bytesPerRun number of input bytes processed by a single call of func
+ * @param func the work to measure
+ * @param minSeconds minimum accumulated run-time of each of the repetitions
+ * @return double best throughput in GB/s
+ */
+template <typename Func_>
+double measure(std::string_view name, std::size_t bytesPerRun, Func_ &&func, double minSeconds = 0.2)
+{
+    using clock            = std::chrono::steady_clock;
+    constexpr int kRepeats = 5;
+    double        best     = 0.0;
+
+    for (int repeat = 0; repeat < kRepeats; repeat++)
+    {
+        std::size_t runs  = 0UL;
+        auto const  start = clock::now();
+        double      elapsed{};
+        do
+        {
+            func();
+            runs++;
+            elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        } while (elapsed < minSeconds);
+        best = std::max(best, static_cast<double>(bytesPerRun * runs) / elapsed / 1.0e9);
+    }
+    std::cout << std::left << std::setw(56) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(10) << best << " GB/s" << std::endl;
+
+    return best;
+}
+
+/**
+ * @brief Print the ratio of two throughput figures.
+ *
+ * @param optimised throughput of the optimised variant
+ * @param baseline throughput of the baseline variant
+ */
+inline void reportSpeedup(double optimised, double baseline)
+{
+    std::cout << std::left << std::setw(56) << "  speed-up" << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << (baseline > 0.0 ? optimised / baseline : 0.0) << " x" << std::endl;
+}
+
+/**
+ * @brief Create a pseudo-random string drawn from a given alphabet.
+ *
+ * @param length length of the string
+ * @param alphabet characters to draw from
+ * @param seed seed of the random generator, so that runs are reproducible
+ * @return std::string the random string
+ */
+inline std::string randomString(std::size_t length, std::string_view alphabet, unsigned seed = 42U)
+{
+    std::mt19937                               gen{seed};
+    std::uniform_int_distribution<std::size_t> dist{0UL, std::size(alphabet) - 1UL};
+    std::string                                reval(length, ' ');
+    std::ranges::generate(reval, [&] { return alphabet[dist(gen)]; });
+
+    return reval;
+}
+} // namespace bench
+
+#endif // NS_UTIL_BENCH_UTIL_H_INCLUDED
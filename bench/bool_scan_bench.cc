@@ -0,0 +1,118 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/bool_scan_bench.cc
+ * Description: allocation-free util::scanBoolString versus lower-casing into a map lookup
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The implementation util::scanBoolString used before the perfect-hash table.
+ */
+bool mapScanBoolString(std::string const &strVal, bool &result)
+{
+    static std::map<std::string, bool, std::less<>> const VALID_BOOL = {
+        {"true",  true },
+        {"t",     true },
+        {"yes",   true },
+        {"y",     true },
+        {"1",     true },
+        {"on",    true },
+        {"false", false},
+        {"f",     false},
+        {"no",    false},
+        {"n",     false},
+        {"0",     false},
+        {"off",   false}
+    };
+
+    auto lower = util::toLower(strVal);
+    auto found = VALID_BOOL.find(lower);
+    result     = found != VALID_BOOL.end() ? found->second : false;
+
+    return found != VALID_BOOL.end();
+}
+
+inline constexpr util::BoolVocabulary SWITCHES{{
+    {"enabled",  true },
+    {"disabled", false},
+    {"ja",       true },
+    {"nein",     false},
+    {"oui",      true },
+    {"non",      false},
+}};
+inline constexpr auto EXTENDED = util::BOOL_VOCABULARY | SWITCHES;
+} // namespace
+
+int main()
+{
+    std::vector<std::string> const spellings{
+        "true", "False", "YES", "no", "On", "off", "T", "f", "1", "0", "maybe", "Enabled", "", "TRUE", "n", "y"
+    };
+    std::vector<std::string> values;
+    std::size_t              totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < 100'000UL; i++)
+    {
+        values.push_back(spellings[(i * 7UL) % std::size(spellings)]);
+        totalBytes += std::size(values.back());
+    }
+
+    std::cout << "-- 100'000 mixed-case boolean spellings, 1/8 invalid" << std::endl;
+    auto const mapped = bench::measure("toLower + std::map lookup", totalBytes, [&] {
+        std::size_t trues = 0UL;
+        for (auto const &value: values)
+        {
+            bool result = false;
+            trues += mapScanBoolString(value, result) && result ? 1UL : 0UL;
+        }
+        bench::doNotOptimize(trues);
+    });
+    auto const hashed = bench::measure("util::scanBoolString", totalBytes, [&] {
+        std::size_t trues = 0UL;
+        for (auto const &value: values)
+        {
+            bool result = false;
+            trues += util::scanBoolString(value, result) && result ? 1UL : 0UL;
+        }
+        bench::doNotOptimize(trues);
+    });
+    bench::reportSpeedup(hashed, mapped);
+    auto const extended = bench::measure("util::scanBoolString<BOOL_VOCABULARY | SWITCHES>", totalBytes, [&] {
+        std::size_t trues = 0UL;
+        for (auto const &value: values)
+        {
+            bool result = false;
+            trues += util::scanBoolString<EXTENDED>(value, result) && result ? 1UL : 0UL;
+        }
+        bench::doNotOptimize(trues);
+    });
+    bench::reportSpeedup(extended, mapped);
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/case_conversion_bench.cc
+ * Description: throughput of util::toLower / util::toUpper against the per-character towlower loop
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <cwctype>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr std::string_view HEADER_KEY_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz-_0123456789";
+
+/**
+ * @brief The per-character implementation that util::toLower used before the SIMD kernels.
+ */
+std::string perCharToLower(std::string const &str)
+{
+    std::string reval;
+    for (auto c: str)
+    {
+        reval += static_cast<char>(towlower(static_cast<wchar_t>(c)));
+    }
+
+    return reval;
+}
+
+std::vector<std::string> makeShortKeys(std::size_t count, std::size_t &totalBytes)
+{
+    std::vector<std::string> keys;
+    totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < count; i++)
+    {
+        keys.emplace_back(bench::randomString(8UL + (i % 24UL), HEADER_KEY_CHARS, static_cast<unsigned>(i)));
+        totalBytes += std::size(keys.back());
+    }
+
+    return keys;
+}
+} // namespace
+
+int main()
+{
+    std::cout << "SIMD block size: " << util::detail::SIMD_BLOCK_SIZE << " bytes" << std::endl;
+
+    std::size_t keyBytes = 0UL;
+    auto const  keys     = makeShortKeys(100'000UL, keyBytes);
+
+    std::cout << "-- short header keys (8..31 bytes)" << std::endl;
+    auto const baseKeys = bench::measure("per-char towlower", keyBytes, [&] {
+        for (auto const &key: keys)
+        {
+            bench::doNotOptimize(perCharToLower(key));
+        }
+    });
+    auto const simdKeys = bench::measure("util::toLower", keyBytes, [&] {
+        for (auto const &key: keys)
+        {
+            bench::doNotOptimize(util::toLower(key));
+        }
+    });
+    bench::reportSpeedup(simdKeys, baseKeys);
+    bench::measure("util::toUpper", keyBytes, [&] {
+        for (auto const &key: keys)
+        {
+            bench::doNotOptimize(util::toUpper(key));
+        }
+    });
+
+    constexpr std::size_t bufferSize = 8UL * 1'024UL * 1'024UL;
+    auto const            ascii      = bench::randomString(bufferSize, HEADER_KEY_CHARS);
+    auto                  mixed      = ascii;
+    for (std::size_t i = 0UL; i < bufferSize; i += 4'096UL)
+    {
+        mixed[i] = '\xC4'; // one non-ASCII byte per page forces the fallback for a few blocks
+    }
+
+    std::cout << "-- 8 MiB buffer" << std::endl;
+    auto const baseBuf = bench::measure("per-char towlower (ASCII)", bufferSize, [&] {
+        bench::doNotOptimize(perCharToLower(ascii));
+    });
+    auto const simdBuf = bench::measure("util::toLower (ASCII)", bufferSize, [&] {
+        bench::doNotOptimize(util::toLower(ascii));
+    });
+    bench::reportSpeedup(simdBuf, baseBuf);
+    bench::measure("util::toLower (1 non-ASCII byte per 4 KiB)", bufferSize, [&] {
+        bench::doNotOptimize(util::toLower(mixed));
+    });
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/mapped_text_file_bench.cc
+ * Description: ingesting a CSV file through util::MappedTextFile versus std::getline copies
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "mapped_text_file.h"
+#include "stringutil.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+int main()
+{
+    constexpr std::size_t fileSize = 64UL * 1'024UL * 1'024UL;
+    std::string const     path     = "/tmp/mapped_text_file_bench.csv";
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << bench::randomString(fileSize, "abcdefghijklmnopqrstuvwxyz 0123456789,,,,,\n");
+    }
+
+    std::cout << "-- 64 MiB CSV file, lines of ~40 bytes, fields of ~7 bytes" << std::endl;
+    auto const getline = bench::measure("std::getline + util::trim + util::splitIntoVector", fileSize, [&] {
+        std::ifstream in{path, std::ios::binary};
+        std::string   line;
+        std::size_t   count = 0UL;
+        while (std::getline(in, line))
+        {
+            util::trim(line);
+            count += std::size(util::splitIntoVector(line, ','));
+        }
+        bench::doNotOptimize(count);
+    }, 1.0);
+    auto const mapped = bench::measure("util::MappedTextFile::lines + util::trimmedView", fileSize, [&] {
+        util::MappedTextFile const file{path};
+        std::size_t                count = 0UL;
+        for (auto line: file.lines())
+        {
+            for ([[maybe_unused]] auto field: util::splitView(util::trimmedView(line), ','))
+            {
+                count++;
+            }
+        }
+        bench::doNotOptimize(count);
+    }, 1.0);
+    bench::reportSpeedup(mapped, getline);
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/number_column_bench.cc
+ * Description: batch number-class inference of a column versus classifying cell by cell
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "number_column.h"
+#include "stringutil.h"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    constexpr std::size_t                  cellCount = 1'000'000UL;
+    std::mt19937                           gen{42U};
+    std::uniform_int_distribution<int64_t> ints{-1'000'000L, 1'000'000L};
+    std::uniform_real_distribution<double> reals{-1.0e4, 1.0e4};
+    std::vector<std::string>               cells;
+    std::size_t                            totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < cellCount; i++)
+    {
+        cells.push_back(i % 4UL == 0UL ? std::to_string(reals(gen)) : std::to_string(ints(gen)));
+        totalBytes += std::size(cells.back());
+    }
+    std::vector<std::string_view> const column(cells.begin(), cells.end());
+    auto const                          maxThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    std::cout << "-- 1'000'000 cells, 3/4 integers, 1/4 decimals" << std::endl;
+    auto const perCell = bench::measure("util::classifyNumberString per cell", totalBytes, [&] {
+        std::vector<util::NumberClass> classes;
+        classes.reserve(std::size(column));
+        for (auto cell: column)
+        {
+            classes.push_back(util::classifyNumberString(cell));
+        }
+        bench::doNotOptimize(classes);
+    });
+    for (std::size_t threads = 1UL; threads <= maxThreads; threads *= 2UL)
+    {
+        auto const batch = bench::measure(
+            "util::classifyNumberColumn, " + std::to_string(threads) + " thread(s)",
+            totalBytes,
+            [&] { bench::doNotOptimize(util::classifyNumberColumn(column, threads)); }
+        );
+        bench::reportSpeedup(batch, perCell);
+    }
+
+    return 0;
+}
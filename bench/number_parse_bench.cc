@@ -0,0 +1,142 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/number_parse_bench.cc
+ * Description: fused util::parseNumber versus classifying first and parsing again with stoll/stod
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The heuristic util::classifyNumberString used before parseNumber.
+ */
+util::NumberClass heuristicClassify(std::string const &str)
+{
+    static std::size_t const maxIntLen  = std::size(std::to_string(std::numeric_limits<int64_t>::max()));
+    static std::size_t const maxUintLen = std::size(std::to_string(std::numeric_limits<uint64_t>::max()));
+
+    using enum util::NumberClass;
+    if (std::empty(str) || str.find_first_not_of("0123456789+-.eElL") != std::string::npos)
+    {
+        return NONE;
+    }
+    if (str.find_first_of(".e") != std::string::npos)
+    {
+        return FLOAT;
+    }
+    auto const isNegative = str[0] == '-';
+    auto const length     = std::size(str) - (str[0] == '-' || str[0] == '+' ? 1UL : 0UL);
+    if (length > maxUintLen)
+    {
+        return FLOAT;
+    }
+
+    return length >= maxIntLen ? (isNegative ? FLOAT : UINT) : INT;
+}
+
+/**
+ * @brief A column of mixed numbers: integers, decimals, exponents and the odd non-number.
+ */
+std::vector<std::string> makeNumbers(std::size_t count, std::size_t &totalBytes)
+{
+    std::mt19937                           gen{42U};
+    std::uniform_int_distribution<int64_t> ints{-1'000'000'000L, 1'000'000'000L};
+    std::uniform_real_distribution<double> reals{-1.0e6, 1.0e6};
+    std::vector<std::string>               numbers;
+    totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < count; i++)
+    {
+        switch (i % 4UL)
+        {
+            case 0UL:
+            case 1UL:
+                numbers.push_back(std::to_string(ints(gen)));
+                break;
+            case 2UL:
+                numbers.push_back(std::to_string(reals(gen)));
+                break;
+            default:
+                numbers.push_back(i % 40UL == 3UL ? "n/a" : std::to_string(reals(gen)) + "e-3");
+                break;
+        }
+        totalBytes += std::size(numbers.back());
+    }
+
+    return numbers;
+}
+} // namespace
+
+int main()
+{
+    std::size_t totalBytes = 0UL;
+    auto const  numbers    = makeNumbers(200'000UL, totalBytes);
+
+    std::cout << "-- 200'000 numbers, half integers, half floats, 2.5% invalid" << std::endl;
+    auto const twoPass = bench::measure("heuristic classify + std::stoll/stoull/stod", totalBytes, [&] {
+        double sum = 0.0;
+        for (auto const &number: numbers)
+        {
+            switch (heuristicClassify(number))
+            {
+                case util::NumberClass::INT:
+                    sum += static_cast<double>(std::stoll(number));
+                    break;
+                case util::NumberClass::UINT:
+                    sum += static_cast<double>(std::stoull(number));
+                    break;
+                case util::NumberClass::FLOAT:
+                    sum += std::stod(number);
+                    break;
+                default:
+                    break;
+            }
+        }
+        bench::doNotOptimize(sum);
+    });
+    auto const fused = bench::measure("util::parseNumber", totalBytes, [&] {
+        double sum = 0.0;
+        for (auto const &number: numbers)
+        {
+            std::visit(
+                [&sum](auto value) {
+                    if constexpr (!std::is_same_v<decltype(value), std::monostate>)
+                    {
+                        sum += static_cast<double>(value);
+                    }
+                },
+                util::parseNumber(number)
+            );
+        }
+        bench::doNotOptimize(sum);
+    });
+    bench::reportSpeedup(fused, twoPass);
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/parallel_split_bench.cc
+ * Description: scaling of util::parallelSplit over 1 to N threads
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "parallel_split.h"
+#include "stringutil.h"
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    constexpr std::size_t bufferSize = 128UL * 1'024UL * 1'024UL;
+    auto const            buffer     = bench::randomString(bufferSize, "abcdefghij,");
+    auto const            maxThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    std::cout << "-- 128 MiB buffer, fields of ~10 bytes, up to " << maxThreads << " threads" << std::endl;
+    auto const serial = bench::measure("util::splitIntoVector (serial, owned)", bufferSize, [&] {
+        bench::doNotOptimize(util::splitIntoVector(buffer, ','));
+    }, 1.0);
+
+    double oneThread = 0.0;
+    for (std::size_t threads = 1UL; threads <= maxThreads; threads *= 2UL)
+    {
+        auto const views = bench::measure(
+            "util::parallelSplit (views), " + std::to_string(threads) + " thread(s)",
+            bufferSize,
+            [&] { bench::doNotOptimize(util::parallelSplit(buffer, ',', threads)); },
+            1.0
+        );
+        oneThread = threads == 1UL ? views : oneThread;
+        bench::reportSpeedup(views, oneThread);
+        auto const owned = bench::measure(
+            "util::parallelSplit<std::string>, " + std::to_string(threads) + " thread(s)",
+            bufferSize,
+            [&] { bench::doNotOptimize(util::parallelSplit<std::string>(buffer, ',', threads)); },
+            1.0
+        );
+        bench::reportSpeedup(owned, serial);
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/replace_all_bench.cc
+ * Description: util::replaceAll with an Aho-Corasick automaton versus std::string::replace loops
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "replace_all.h"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief One std::string::find/replace loop per pattern, as replacing was done without the library.
+ */
+void loopReplaceAll(std::string &str, std::vector<std::pair<std::string_view, std::string_view>> const &replacements)
+{
+    for (auto const &[from, to]: replacements)
+    {
+        for (auto pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + std::size(to)))
+        {
+            str.replace(pos, std::size(from), to);
+        }
+    }
+}
+} // namespace
+
+int main()
+{
+    std::vector<std::pair<std::string_view, std::string_view>> const escapes{
+        {"&",  "&amp;" },
+        {"<",  "&lt;"  },
+        {">",  "&gt;"  },
+        {"\"", "&quot;"},
+        {"'",  "&#39;" },
+    };
+    util::ReplaceAutomaton<char> const escapeAutomaton{escapes};
+
+    auto const  source = bench::randomString(256UL * 1'024UL, "abcdefghijklmnopqrstuvwxyz     <>&\"'\n");
+    std::string result;
+    std::cout << "-- HTML-escape 256 KiB with 5 patterns, ~1 in 8 characters replaced" << std::endl;
+    auto const looped = bench::measure("std::string::replace loops", std::size(source), [&] {
+        result = source;
+        loopReplaceAll(result, escapes);
+        bench::doNotOptimize(result);
+    });
+    auto const automaton = bench::measure("util::replaceAll (prebuilt automaton)", std::size(source), [&] {
+        result = source;
+        util::replaceAll(result, escapeAutomaton);
+        bench::doNotOptimize(result);
+    });
+    bench::reportSpeedup(automaton, looped);
+
+    // a dictionary of words, only some of which occur
+    std::vector<std::string> words;
+    for (std::size_t i = 0UL; i < 200UL; i++)
+    {
+        words.push_back(bench::randomString(3UL + i % 6UL, "abcdefgh", unsigned(i)));
+    }
+    std::vector<std::pair<std::string_view, std::string_view>> dictionary;
+    for (auto const &word: words)
+    {
+        dictionary.emplace_back(word, "<word>");
+    }
+    util::ReplaceAutomaton<char> const dictionaryAutomaton{dictionary};
+    auto const text = bench::randomString(256UL * 1'024UL, "abcdefghijklmnopqrstuvwxyz ");
+    std::cout << "-- replace 200 words in 256 KiB of text" << std::endl;
+    auto const loopedDictionary = bench::measure("std::string::replace loops", std::size(text), [&] {
+        result = text;
+        loopReplaceAll(result, dictionary);
+        bench::doNotOptimize(result);
+    });
+    auto const automatonDictionary = bench::measure("util::replaceAll (prebuilt automaton)", std::size(text), [&] {
+        result = text;
+        util::replaceAll(result, dictionaryAutomaton);
+        bench::doNotOptimize(result);
+    });
+    bench::reportSpeedup(automatonDictionary, loopedDictionary);
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/search_bench.cc
+ * Description: micro-benchmark of the precompiled substring search against std::string::find
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "ci_string.h"
+#include "searcher.h"
+#include "stringutil.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+void benchNeedle(std::string const &text, std::string const &needle)
+{
+    std::cout << "-- 16 MiB of English-like text, needle of " << std::size(needle) << " bytes" << std::endl;
+    auto const plain = bench::measure("std::string::find", std::size(text), [&] {
+        std::size_t count = 0UL;
+        for (auto pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1UL))
+        {
+            count++;
+        }
+        bench::doNotOptimize(count);
+    });
+    util::Searcher<char> const searcher{needle};
+    auto const                 searched = bench::measure("util::Searcher::find", std::size(text), [&] {
+        std::size_t count = 0UL;
+        for (auto pos = searcher.find(text); pos != std::string::npos; pos = searcher.find(text, pos + 1UL))
+        {
+            count++;
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::reportSpeedup(searched, plain);
+}
+
+void benchCiNeedle(util::ci_string const &text, util::ci_string const &needle)
+{
+    std::cout << "-- 1 MiB case-insensitive, needle of " << std::size(needle) << " bytes" << std::endl;
+    auto const plain = bench::measure("util::ci_string::find", std::size(text), [&] {
+        std::size_t count = 0UL;
+        for (auto pos = text.find(needle); pos != util::ci_string::npos; pos = text.find(needle, pos + 1UL))
+        {
+            count++;
+        }
+        bench::doNotOptimize(count);
+    });
+    util::Searcher<char, util::ci_char_traits<char>> const searcher{needle};
+    auto const searched = bench::measure("util::Searcher<ci_char_traits>::find", std::size(text), [&] {
+        std::size_t count = 0UL;
+        for (auto pos = searcher.find(text); pos != util::ci_string::npos; pos = searcher.find(text, pos + 1UL))
+        {
+            count++;
+        }
+        bench::doNotOptimize(count);
+    });
+    bench::reportSpeedup(searched, plain);
+}
+} // namespace
+
+int main()
+{
+    // lower-case letters and spaces, so that first bytes of the needles occur often
+    auto const text = bench::randomString(16UL * 1'024UL * 1'024UL, "etaoinshrdlucmfwypvbgkjqxz     ");
+
+    benchNeedle(text, "the");
+    benchNeedle(text, "needle");
+    benchNeedle(text, "some longer needle to be found");
+    benchNeedle(text, "a needle that is far longer than the filtered length, so it is skipped through");
+
+    auto const mixedCase = bench::randomString(1'024UL * 1'024UL, "etaoinshrdluETAOINSHRDLUcmfwypvbgkjqxz     ");
+    util::ci_string const ciText{std::data(mixedCase), std::size(mixedCase)};
+    benchCiNeedle(ciText, "The");
+    benchCiNeedle(ciText, "some longer NEEDLE to be found");
+    benchCiNeedle(ciText, "a needle that is far longer than the filtered length, so it is skipped through");
+
+    std::string csv;
+    for (std::size_t i = 0UL; i < 200'000UL; i++)
+    {
+        csv += bench::randomString(40UL, "abcdefghij0123456789 ", unsigned(i));
+        csv += "<|>";
+    }
+    std::cout << "-- split " << std::size(csv) << " bytes at a 3-byte separator into views" << std::endl;
+    auto const viaStd = bench::measure("std::string::find loop", std::size(csv), [&] {
+        std::vector<std::string_view> tokens;
+        std::string_view const        view{csv};
+        std::size_t                   start = 0UL;
+        for (auto pos = view.find("<|>"); pos != std::string_view::npos; pos = view.find("<|>", start))
+        {
+            tokens.push_back(view.substr(start, pos - start));
+            start = pos + 3UL;
+        }
+        tokens.push_back(view.substr(start));
+        bench::doNotOptimize(tokens);
+    });
+    auto const viaSplit = bench::measure("util::splitView", std::size(csv), [&] {
+        std::vector<std::string_view> tokens;
+        for (auto const token: util::splitView(csv, "<|>"))
+        {
+            tokens.push_back(token);
+        }
+        bench::doNotOptimize(tokens);
+    });
+    bench::reportSpeedup(viaSplit, viaStd);
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/split_bench.cc
+ * Description: throughput of util::splitIntoVector / util::splitView on TSV lines with many short fields
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr std::string_view FIELD_CHARS = "abcdefghijklmnopqrstuvwxyz0123456789.:-";
+
+/**
+ * @brief The find-loop implementation that util::splitIntoVector used before the separator-bitmask kernel.
+ */
+std::vector<std::string> findLoopSplit(std::string const &str, char sep)
+{
+    std::vector<std::string> results;
+    std::size_t              subStrStart = 0UL;
+    std::size_t              sepStart    = str.find(sep);
+
+    if (sepStart > std::size(str))
+    {
+        results.emplace_back(str);
+        return results;
+    }
+
+    bool finished = false;
+    while (!finished)
+    {
+        if (sepStart == subStrStart)
+        {
+            results.emplace_back();
+        }
+        else
+        {
+            results.emplace_back(util::substr_from_to_incl(str, subStrStart, sepStart - 1));
+        }
+        subStrStart = sepStart + 1UL;
+        sepStart    = str.find(sep, subStrStart);
+        if (sepStart > std::size(str))
+        {
+            finished = true;
+            results.emplace_back(util::substr_from_to_incl(str, subStrStart, sepStart - 1));
+        }
+    }
+
+    return results;
+}
+
+/**
+ * @brief Create TSV log lines of fieldCount fields of 1..8 characters each.
+ */
+std::vector<std::string> makeTsvLines(std::size_t lineCount, std::size_t fieldCount, std::size_t &totalBytes)
+{
+    std::vector<std::string> lines;
+    totalBytes = 0UL;
+    for (std::size_t l = 0UL; l < lineCount; l++)
+    {
+        std::string line;
+        for (std::size_t f = 0UL; f < fieldCount; f++)
+        {
+            if (f > 0UL)
+            {
+                line += '\t';
+            }
+            line += bench::randomString(1UL + ((l + f) % 8UL), FIELD_CHARS, static_cast<unsigned>(l * fieldCount + f));
+        }
+        totalBytes += std::size(line);
+        lines.emplace_back(std::move(line));
+    }
+
+    return lines;
+}
+} // namespace
+
+int main()
+{
+    std::cout << "SIMD block size: " << util::detail::SIMD_BLOCK_SIZE << " bytes" << std::endl;
+
+    std::size_t lineBytes = 0UL;
+    auto const  lines     = makeTsvLines(2'000UL, 200UL, lineBytes);
+
+    std::cout << "-- TSV lines, 200 fields of 1..8 bytes" << std::endl;
+    auto const baseVector = bench::measure("find-loop splitIntoVector", lineBytes, [&] {
+        for (auto const &line: lines)
+        {
+            bench::doNotOptimize(findLoopSplit(line, '\t'));
+        }
+    });
+    auto const simdVector = bench::measure("util::splitIntoVector", lineBytes, [&] {
+        for (auto const &line: lines)
+        {
+            bench::doNotOptimize(util::splitIntoVector(line, '\t'));
+        }
+    });
+    bench::reportSpeedup(simdVector, baseVector);
+    bench::measure("util::splitIntoSet", lineBytes, [&] {
+        for (auto const &line: lines)
+        {
+            bench::doNotOptimize(util::splitIntoSet(line, '\t'));
+        }
+    });
+    auto const viewAll = bench::measure("util::splitView (all fields, no copies)", lineBytes, [&] {
+        for (auto const &line: lines)
+        {
+            std::size_t fieldBytes = 0UL;
+            for (auto field: util::splitView(line, '\t'))
+            {
+                fieldBytes += std::size(field);
+            }
+            bench::doNotOptimize(fieldBytes);
+        }
+    });
+    bench::reportSpeedup(viewAll, baseVector);
+    bench::measure("util::splitView | drop(2) | take(1) (field 3 only)", lineBytes, [&] {
+        for (auto const &line: lines)
+        {
+            for (auto field: util::splitView(line, '\t') | std::views::drop(2) | std::views::take(1))
+            {
+                bench::doNotOptimize(field);
+            }
+        }
+    });
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/stream_split_bench.cc
+ * Description: streaming split of a file versus reading it whole, throughput and peak memory
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stream_split.h"
+#include "stringutil.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace
+{
+/**
+ * @brief Peak resident set size of the process so far, in MiB.
+ */
+long peakRssMiB()
+{
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss / 1'024L;
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t fileSize = 128UL * 1'024UL * 1'024UL;
+    std::string const     path     = "/tmp/stream_split_bench.txt";
+    {
+        // written in pieces, so that generating the file does not raise the peak RSS
+        std::ofstream         out{path, std::ios::binary};
+        constexpr std::size_t pieceSize = 1'024UL * 1'024UL;
+        for (unsigned piece = 0U; piece < fileSize / pieceSize; piece++)
+        {
+            out << bench::randomString(pieceSize, "abcdefghijklmnopqrstuvwxyz0123456789,,,,\n", piece);
+        }
+    }
+
+    std::cout << "-- 128 MiB file of lines, peak RSS before: " << peakRssMiB() << " MiB" << std::endl;
+    // the streaming variants run first, as the peak RSS only ever grows
+    bench::measure("util::fdSplit (64 KiB chunks)", fileSize, [&] {
+        auto const  fd    = ::open(path.c_str(), O_RDONLY);
+        std::size_t count = 0UL;
+        for (auto token: util::fdSplit(fd, '\n'))
+        {
+            count += std::size(token);
+        }
+        ::close(fd);
+        bench::doNotOptimize(count);
+    }, 1.0);
+    bench::measure("util::streamSplit (std::ifstream)", fileSize, [&] {
+        std::ifstream in{path, std::ios::binary};
+        std::size_t   count = 0UL;
+        for (auto token: util::streamSplit(in, '\n'))
+        {
+            count += std::size(token);
+        }
+        bench::doNotOptimize(count);
+    }, 1.0);
+    std::cout << "  peak RSS after streaming: " << peakRssMiB() << " MiB" << std::endl;
+
+    bench::measure("read whole file + util::splitIntoVector", fileSize, [&] {
+        std::ifstream      in{path, std::ios::binary};
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        bench::doNotOptimize(util::splitIntoVector(contents.str(), '\n'));
+    }, 1.0);
+    std::cout << "  peak RSS after reading whole: " << peakRssMiB() << " MiB" << std::endl;
+    std::remove(path.c_str());
+
+    return 0;
+}
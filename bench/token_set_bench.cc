@@ -0,0 +1,114 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/token_set_bench.cc
+ * Description: splitIntoSet against splitIntoHashSet / splitIntoSortedViews for split-then-lookup tag parsing
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+constexpr std::string_view TAG_CHARS = "abcdefghijklmnopqrstuvwxyz-";
+
+/**
+ * @brief Create comma-separated tag lists of tagCount tags each, drawn from a vocabulary with repetitions.
+ */
+std::vector<std::string> makeTagLists(std::size_t listCount, std::size_t tagCount, std::size_t &totalBytes)
+{
+    std::vector<std::string> vocabulary;
+    for (std::size_t i = 0UL; i < 64UL; i++)
+    {
+        vocabulary.emplace_back(bench::randomString(4UL + i % 12UL, TAG_CHARS, static_cast<unsigned>(i)));
+    }
+
+    std::vector<std::string> lists;
+    totalBytes = 0UL;
+    for (std::size_t l = 0UL; l < listCount; l++)
+    {
+        std::string list;
+        for (std::size_t t = 0UL; t < tagCount; t++)
+        {
+            list += (t > 0UL ? "," : "") + vocabulary[(l * 7UL + t * 13UL) % std::size(vocabulary)];
+        }
+        totalBytes += std::size(list);
+        lists.emplace_back(std::move(list));
+    }
+
+    return lists;
+}
+} // namespace
+
+int main()
+{
+    std::size_t listBytes = 0UL;
+    auto const  lists     = makeTagLists(20'000UL, 24UL, listBytes);
+    // every event is split, then checked for a handful of tags
+    std::vector<std::string> const probes{"prod", "canary", "eu-west", "abcd", "web"};
+
+    std::cout << "-- tag lists of 24 tags, split then 5 membership tests" << std::endl;
+    auto const nodeSet = bench::measure("util::splitIntoSet + contains", listBytes, [&] {
+        std::size_t hits = 0UL;
+        for (auto const &list: lists)
+        {
+            auto const tags = util::splitIntoSet(list, ',');
+            for (auto const &probe: probes)
+            {
+                hits += tags.contains(probe) ? 1UL : 0UL;
+            }
+        }
+        bench::doNotOptimize(hits);
+    });
+    auto const hashSet = bench::measure("util::splitIntoHashSet + contains", listBytes, [&] {
+        std::size_t hits = 0UL;
+        for (auto const &list: lists)
+        {
+            auto const tags = util::splitIntoHashSet(list, ',');
+            for (auto const &probe: probes)
+            {
+                hits += tags.contains(probe) ? 1UL : 0UL;
+            }
+        }
+        bench::doNotOptimize(hits);
+    });
+    bench::reportSpeedup(hashSet, nodeSet);
+    auto const flatViews = bench::measure("util::splitIntoSortedViews + binary_search", listBytes, [&] {
+        std::size_t hits = 0UL;
+        for (auto const &list: lists)
+        {
+            auto const tags = util::splitIntoSortedViews(list, ',');
+            for (auto const &probe: probes)
+            {
+                hits += std::ranges::binary_search(tags, std::string_view{probe}) ? 1UL : 0UL;
+            }
+        }
+        bench::doNotOptimize(hits);
+    });
+    bench::reportSpeedup(flatViews, nodeSet);
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/transcode_bench.cc
+ * Description: Micro-benchmark of converting strings between char-types, UTF-8, UTF-16 and UTF-32.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "bench_util.h"
+#include "ci_string.h"
+#include "decorator.h"
+#include "stringutil.h"
+
+#include <algorithm>
+#include <clocale>
+#include <cwchar>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The former util::convert: every code unit cast and appended, which is only correct for ASCII.
+ */
+template <typename StringToT_, typename StringFromT_> StringToT_ castEachCodeUnit(StringFromT_ const &from)
+{
+    StringToT_ to;
+    std::ranges::transform(from, std::back_inserter(to), [](auto c) {
+        return static_cast<typename StringToT_::value_type>(c);
+    });
+
+    return to;
+}
+
+/**
+ * @brief The C library way of decoding UTF-8 into wide characters.
+ */
+std::wstring libcToWString(std::string const &str)
+{
+    std::wstring   reval(std::size(str), L'\0');
+    std::mbstate_t state{};
+    char const    *src   = std::data(str);
+    auto const     count = std::mbsrtowcs(std::data(reval), &src, std::size(reval), &state);
+    reval.resize(count == static_cast<std::size_t>(-1) ? 0UL : count);
+
+    return reval;
+}
+
+/**
+ * @brief The C library way of encoding wide characters as UTF-8.
+ */
+std::string libcToString(std::wstring const &str)
+{
+    std::string    reval(4UL * std::size(str), '\0');
+    std::mbstate_t state{};
+    wchar_t const *src   = std::data(str);
+    auto const     count = std::wcsrtombs(std::data(reval), &src, std::size(reval), &state);
+    reval.resize(count == static_cast<std::size_t>(-1) ? 0UL : count);
+
+    return reval;
+}
+
+std::string repeated(std::string_view text, std::size_t size)
+{
+    std::string reval;
+    while (std::size(reval) < size)
+    {
+        reval += text;
+    }
+
+    return reval;
+}
+} // namespace
+
+int main()
+{
+    if (std::setlocale(LC_CTYPE, "C.UTF-8") == nullptr)
+    {
+        std::cout << "no C.UTF-8 locale, the C library cannot decode UTF-8" << std::endl;
+        return 0;
+    }
+    constexpr std::size_t size = 256UL * 1'024UL;
+
+    auto const ascii = repeated("2026-10-16 12:00:01 INFO request served in 12 ms, status=200\n", size);
+    std::cout << "-- 256 KiB of ASCII, std::string -> std::wstring" << std::endl;
+    auto const castAscii    = bench::measure("cast each code unit", std::size(ascii), [&] {
+        bench::doNotOptimize(castEachCodeUnit<std::wstring>(ascii));
+    });
+    auto const convertAscii = bench::measure("util::convert", std::size(ascii), [&] {
+        bench::doNotOptimize(util::convert<std::wstring>(ascii));
+    });
+    bench::reportSpeedup(convertAscii, castAscii);
+
+    auto const ciAscii = util::ci_string{std::data(ascii), std::size(ascii)};
+    std::cout << "-- 256 KiB of ASCII, util::ci_string -> std::string (same width)" << std::endl;
+    auto const castSame    = bench::measure("cast each code unit", std::size(ascii), [&] {
+        bench::doNotOptimize(castEachCodeUnit<std::string>(ciAscii));
+    });
+    auto const convertSame = bench::measure("util::convert", std::size(ascii), [&] {
+        bench::doNotOptimize(util::convert<std::string>(ciAscii));
+    });
+    bench::reportSpeedup(convertSame, castSame);
+
+    auto const asciiUtf32 = util::convert<std::u32string>(ascii);
+    std::cout << "-- 256 KiB of ASCII, std::u32string -> std::string (narrowing)" << std::endl;
+    auto const castNarrow    = bench::measure("cast each code unit", std::size(ascii), [&] {
+        bench::doNotOptimize(castEachCodeUnit<std::string>(asciiUtf32));
+    });
+    auto const convertNarrow = bench::measure("util::convert", std::size(ascii), [&] {
+        bench::doNotOptimize(util::convert<std::string>(asciiUtf32));
+    });
+    bench::reportSpeedup(convertNarrow, castNarrow);
+
+    auto const german = repeated("Der Große Österreichische Gruß: GRÜSS GOTT, STRAßENBAHN UND KÄSE. ", size);
+    std::cout << "-- 256 KiB of German text, std::string -> std::wstring" << std::endl;
+    auto const libcDecode    = bench::measure("mbsrtowcs", std::size(german), [&] {
+        bench::doNotOptimize(libcToWString(german));
+    });
+    auto const convertDecode = bench::measure("util::convert", std::size(german), [&] {
+        bench::doNotOptimize(util::convert<std::wstring>(german));
+    });
+    bench::reportSpeedup(convertDecode, libcDecode);
+
+    auto const wide = util::convert<std::wstring>(german);
+    std::cout << "-- 256 KiB of German text, std::wstring -> std::string" << std::endl;
+    auto const libcEncode    = bench::measure("wcsrtombs", std::size(german), [&] {
+        bench::doNotOptimize(libcToString(wide));
+    });
+    auto const convertEncode = bench::measure("util::convert", std::size(german), [&] {
+        bench::doNotOptimize(util::convert<std::string>(wide));
+    });
+    bench::reportSpeedup(convertEncode, libcEncode);
+
+    std::vector<std::string> keys;
+    std::size_t              totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < 1'000'000UL; i++)
+    {
+        keys.push_back("header-" + std::to_string(i * 7'919UL) + (i % 4UL == 0UL ? "-grüße" : "-value"));
+        totalBytes += std::size(keys.back());
+    }
+    std::cout << "-- 1000000 short keys, std::string -> std::u16string" << std::endl;
+    auto const castKeys    = bench::measure("cast each code unit", totalBytes, [&] {
+        for (auto const &key: keys)
+        {
+            bench::doNotOptimize(castEachCodeUnit<std::u16string>(key));
+        }
+    });
+    auto const convertKeys = bench::measure("util::convert", totalBytes, [&] {
+        for (auto const &key: keys)
+        {
+            bench::doNotOptimize(util::convert<std::u16string>(key));
+        }
+    });
+    bench::reportSpeedup(convertKeys, castKeys);
+
+    std::vector<util::ci_string> ciKeys;
+    for (auto const &key: keys)
+    {
+        ciKeys.emplace_back(std::data(key), std::size(key));
+    }
+    std::cout << "-- 1000000 short keys, std::hash<util::ci_string>" << std::endl;
+    auto const castHash = bench::measure("hash of cast lower-case copy", totalBytes, [&] {
+        for (auto const &key: ciKeys)
+        {
+            bench::doNotOptimize(std::hash<std::string>{}(castEachCodeUnit<std::string>(util::toLower(key))));
+        }
+    });
+    auto const ciHash   = bench::measure("std::hash<util::ci_string>", totalBytes, [&] {
+        for (auto const &key: ciKeys)
+        {
+            bench::doNotOptimize(std::hash<util::ci_string>{}(key));
+        }
+    });
+    bench::reportSpeedup(ciHash, castHash);
+
+    return 0;
+}
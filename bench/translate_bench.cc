@@ -0,0 +1,77 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/translate_bench.cc
+ * Description: micro-benchmark of tr-style character translation against chained replaceChar passes
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <string>
+#include <vector>
+
+int main()
+{
+    // records with field separators and control characters that must not leave the system
+    std::vector<std::string> records;
+    std::size_t              totalBytes = 0UL;
+    for (std::size_t i = 0UL; i < 10'000UL; i++)
+    {
+        records.push_back(bench::randomString(200UL, "abcdefghijklmnopqrstuvwxyz0123456789 ,;|\t\r\n=", unsigned(i)));
+        totalBytes += std::size(records.back());
+    }
+
+    std::cout << "-- sanitise 10'000 records of 200 bytes: ',;|' -> '/', control characters -> ' '" << std::endl;
+    auto const chained = bench::measure("3 x util::replaceChar", totalBytes, [&] {
+        for (auto record: records)
+        {
+            util::replaceChar(record, ",;|", '/');
+            util::replaceChar(record, "\t\r", ' ');
+            util::replaceChar(record, "\n", ' ');
+            bench::doNotOptimize(record);
+        }
+    });
+    auto const translated = bench::measure("util::translate", totalBytes, [&] {
+        for (auto record: records)
+        {
+            util::translate(record, ",;|\t\r\n", "///  ");
+            bench::doNotOptimize(record);
+        }
+    });
+    bench::reportSpeedup(translated, chained);
+
+    std::string large = bench::randomString(16UL * 1'024UL * 1'024UL, "abcdefghijklmnopqrstuvwxyz ,;|\t\n");
+    std::cout << "-- 16 MiB in place: ',;|' -> '/', control characters -> ' '" << std::endl;
+    auto const chainedLarge = bench::measure("3 x util::replaceChar", std::size(large), [&] {
+        util::replaceChar(large, ",;|", '/');
+        util::replaceChar(large, "\t", ' ');
+        util::replaceChar(large, "\n", ' ');
+        bench::doNotOptimize(large);
+    });
+    auto const translatedLarge = bench::measure("util::translate", std::size(large), [&] {
+        util::translate(large, ",;|\t\n", "/// ");
+        bench::doNotOptimize(large);
+    });
+    bench::reportSpeedup(translatedLarge, chainedLarge);
+
+    return 0;
+}
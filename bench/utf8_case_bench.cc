@@ -0,0 +1,142 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/utf8_case_bench.cc
+ * Description: micro-benchmark of UTF-8 case mapping against decoding with the C library
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#include "bench_util.h"
+#include "stringutil.h"
+
+#include <array>
+#include <climits>
+#include <clocale>
+#include <cwchar>
+#include <cwctype>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The correct, but slow, way with the C library: decode with mbrtowc, map with towlower, encode with wcrtomb.
+ */
+std::string libcToLower(std::string_view str)
+{
+    std::string reval;
+    reval.reserve(std::size(str));
+    std::mbstate_t decodeState{};
+    std::mbstate_t encodeState{};
+    char           buffer[MB_LEN_MAX];
+    for (std::size_t i = 0UL; i < std::size(str);)
+    {
+        wchar_t    wc  = 0;
+        auto const len = std::mbrtowc(&wc, std::data(str) + i, std::size(str) - i, &decodeState);
+        if (len == 0UL || len > std::size(str))
+        {
+            reval += str[i++];
+            decodeState = {};
+            continue;
+        }
+        auto const written = std::wcrtomb(buffer, static_cast<wchar_t>(std::towlower(wc)), &encodeState);
+        reval.append(buffer, written);
+        i += len;
+    }
+
+    return reval;
+}
+
+std::vector<std::string> userNames(std::array<std::string_view, 12> const &parts, std::size_t count)
+{
+    std::vector<std::string> reval;
+    for (std::size_t i = 0UL; i < count; i++)
+    {
+        reval.push_back(
+            std::string{parts[i % 12UL]} + "." + std::string{parts[(i * 7UL + 3UL) % 12UL]} + "_"
+            + std::string{parts[(i * 5UL + 1UL) % 12UL]}
+        );
+    }
+
+    return reval;
+}
+
+void benchNames(std::string_view title, std::vector<std::string> const &names)
+{
+    std::size_t totalBytes = 0UL;
+    for (auto const &name: names)
+    {
+        totalBytes += std::size(name);
+    }
+    std::cout << "-- " << title << ": " << std::size(names) << " user names, " << totalBytes << " bytes" << std::endl;
+    auto const libc = bench::measure("mbrtowc + towlower + wcrtomb", totalBytes, [&] {
+        for (auto const &name: names)
+        {
+            bench::doNotOptimize(libcToLower(name));
+        }
+    });
+    auto const mapped = bench::measure("util::utf8ToLower", totalBytes, [&] {
+        for (auto const &name: names)
+        {
+            bench::doNotOptimize(util::utf8ToLower(name));
+        }
+    });
+    bench::reportSpeedup(mapped, libc);
+}
+} // namespace
+
+int main()
+{
+    if (std::setlocale(LC_CTYPE, "C.UTF-8") == nullptr)
+    {
+        std::cout << "no C.UTF-8 locale, the C library cannot decode UTF-8" << std::endl;
+        return 0;
+    }
+
+    benchNames(
+        "ASCII",
+        userNames({"Smith", "JOHNSON", "Williams", "Brown", "JONES", "Garcia", "Miller", "Davis", "RODRIGUEZ", "Martinez",
+                   "Hernandez", "Lopez"},
+                  1'000'000UL)
+    );
+    benchNames(
+        "European",
+        userNames({"Müller", "SCHÄFER", "Łukasz", "Ødegård", "Ñúñez", "Dvořák", "ΠΑΠΑΔΌΠΟΥΛΟΣ", "Смирнов", "Öztürk",
+                   "Fontaine", "Åström", "Kovačević"},
+                  1'000'000UL)
+    );
+
+    std::string large;
+    while (std::size(large) < 16UL * 1'024UL * 1'024UL)
+    {
+        large += "Der Große Österreichische Gruß: GRÜSS GOTT, STRAßENBAHN UND KÄSE. ";
+    }
+    std::cout << "-- 16 MiB of German text" << std::endl;
+    auto const libcLarge   = bench::measure("mbrtowc + towlower + wcrtomb", std::size(large), [&] {
+        bench::doNotOptimize(libcToLower(large));
+    });
+    auto const mappedLarge = bench::measure("util::utf8ToLower", std::size(large), [&] {
+        bench::doNotOptimize(util::utf8ToLower(large));
+    });
+    bench::reportSpeedup(mappedLarge, libcLarge);
+
+    return 0;
+}
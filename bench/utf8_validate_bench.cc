@@ -0,0 +1,114 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   bench/utf8_validate_bench.cc
+ * Description: Micro-benchmark of the vectorised UTF-8 validation.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "bench_util.h"
+#include "stream_split.h"
+#include "stringutil.h"
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+/**
+ * @brief The usual scalar validation: decode character by character, with a shortcut for ASCII.
+ */
+bool scalarIsValidUtf8(std::string_view str)
+{
+    auto const *const bytes = reinterpret_cast<unsigned char const *>(std::data(str));
+    std::size_t       i     = 0UL;
+    while (i < std::size(str))
+    {
+        if (bytes[i] < 0x80U)
+        {
+            ++i;
+            continue;
+        }
+        auto const length = util::detail::decodeUtf8(bytes + i, std::size(str) - i).length;
+        if (length == 0UL)
+        {
+            return false;
+        }
+        i += length;
+    }
+
+    return true;
+}
+
+std::string repeated(std::string_view text, std::size_t size)
+{
+    std::string reval;
+    while (std::size(reval) < size)
+    {
+        reval += text;
+    }
+
+    return reval;
+}
+
+void benchText(std::string_view title, std::string const &text)
+{
+    std::cout << "-- " << title << ": " << std::size(text) << " bytes" << std::endl;
+    auto const scalar = bench::measure("decode character by character", std::size(text), [&] {
+        bench::doNotOptimize(scalarIsValidUtf8(text));
+    });
+    auto const vectorised = bench::measure("util::isValidUtf8", std::size(text), [&] {
+        bench::doNotOptimize(util::isValidUtf8(text));
+    });
+    bench::reportSpeedup(vectorised, scalar);
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t size = 16UL * 1'024UL * 1'024UL;
+    benchText("ASCII log lines", repeated("2026-10-16 12:00:01 INFO request served in 12 ms, status=200\n", size));
+    benchText("German text", repeated("Der Große Österreichische Gruß: GRÜSS GOTT, STRAßENBAHN UND KÄSE. ", size));
+    benchText("Greek and Cyrillic", repeated("Καλημέρα κόσμε, Здравствуй мир! ", size));
+    benchText("Chinese and emoji", repeated("你好，世界！漢字とかな 🎉🚀 ", size));
+
+    // the validating stage of a stream splitter costs little more than the split
+    auto const lines = repeated("Grüße,aus,Köln;Καλημέρα,κόσμε;plain,ascii,fields\n", size);
+    std::cout << "-- streamSplit of " << std::size(lines) << " bytes by line" << std::endl;
+    auto const plain      = bench::measure("streamSplit", std::size(lines), [&] {
+        std::istringstream in{lines};
+        for (auto token: util::streamSplit(in, '\n'))
+        {
+            bench::doNotOptimize(token);
+        }
+    });
+    auto const validating = bench::measure("streamSplit, InputValidation::UTF8", std::size(lines), [&] {
+        std::istringstream in{lines};
+        for (auto token: util::streamSplit(in, '\n', util::StreamSplitter<char>::DEFAULT_CHUNK_SIZE,
+                                           util::InputValidation::UTF8))
+        {
+            bench::doNotOptimize(token);
+        }
+    });
+    bench::reportSpeedup(validating, plain);
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/bulk_executor.h
+ * Description: bulk executors running a number of independent tasks, possibly in parallel
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_BULK_EXECUTOR_H_INCLUDED
+#define NS_UTIL_BULK_EXECUTOR_H_INCLUDED
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+/**
+ * @brief Check whether ExecutorT_ can run bulk work: it needs to report how many tasks it runs concurrently, and
+ *        bulk(n, task) must call task(0) ... task(n - 1), possibly in parallel, and return when all have finished.
+ */
+template <typename ExecutorT_>
+inline constexpr bool is_bulk_executor_v = requires(ExecutorT_ &executor, void (*task)(std::size_t)) {
+    { executor.concurrency() } -> std::convertible_to<std::size_t>;
+    executor.bulk(std::size_t{}, task);
+};
+
+/**
+ * @brief Bulk executor running each task on its own thread, the first one on the calling thread.
+ */
+class ThreadExecutor
+{
+  public:
+    /**
+     * @brief Construct an executor for the given number of threads.
+     *
+     * @param threadCount maximal number of concurrent tasks, defaults to the number of hardware threads
+     */
+    explicit ThreadExecutor(std::size_t threadCount = std::thread::hardware_concurrency())
+        : threadCount_(std::max(threadCount, 1UL))
+    {
+    }
+
+    /**
+     * @brief Number of tasks run concurrently.
+     *
+     * @return std::size_t the thread count
+     */
+    [[nodiscard]] std::size_t concurrency() const
+    {
+        return threadCount_;
+    }
+
+    /**
+     * @brief Run task(0) ... task(n - 1) concurrently and wait for all of them.
+     *        An exception thrown by a task is re-thrown once all tasks have finished.
+     *
+     * @tparam Func_ callable taking a std::size_t
+     * @param n number of tasks
+     * @param task the task
+     */
+    template <typename Func_> void bulk(std::size_t n, Func_ &&task) const
+    {
+        std::vector<std::exception_ptr> errors(n);
+        auto const                      guarded = [&task, &errors](std::size_t index) {
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        };
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(n);
+            for (std::size_t index = 1UL; index < n; index++)
+            {
+                threads.emplace_back(guarded, index);
+            }
+            if (n > 0UL)
+            {
+                guarded(0UL);
+            }
+        }
+        for (auto const &error: errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+  private:
+    std::size_t threadCount_;
+};
+
+} // namespace util
+
+#endif // NS_UTIL_BULK_EXECUTOR_H_INCLUDED
@@ -0,0 +1,266 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/char_set.h
+ * Description: compile-time character sets for strip/trim/replace character classes
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_CHAR_SET_H_INCLUDED
+#define NS_UTIL_CHAR_SET_H_INCLUDED
+
+#include "simd_kernels.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+/**
+ * @brief A set of characters with constant-time membership test, usable at compile time.
+ *        Characters with a code below 256 live in a 256-bit bitmap, so testing them is a single bit probe.
+ *        Larger (wide) characters are kept in a small open-addressing hash table of WIDE_CAPACITY slots.
+ *        The set is independent of the char-type: a character is identified by its unsigned code, so that
+ *        f.e. a set built from "\xC4" (char) contains L'\xC4' (wchar_t) as well.
+ *        Membership is exact, even when used on case-insensitive strings.
+ */
+class CharSet
+{
+  public:
+    static constexpr std::size_t WIDE_CAPACITY = 64UL;
+    static constexpr std::size_t MAX_WIDE      = 48UL;
+    static constexpr bool        EAGER         = true;
+
+    /**
+     * @brief Construct an empty set.
+     */
+    constexpr CharSet() = default;
+
+    /**
+     * @brief Construct a set from all characters of a string.
+     *
+     * @tparam CharT_ char-type
+     * @tparam TraitsT_ char-traits
+     * @param chars the characters
+     */
+    template <typename CharT_, typename TraitsT_>
+    constexpr explicit CharSet(std::basic_string_view<CharT_, TraitsT_> chars)
+    {
+        for (auto c: chars)
+        {
+            insert(c);
+        }
+    }
+
+    /**
+     * @brief Construct a set from all characters of a string.
+     *
+     * @tparam CharT_ char-type
+     * @tparam TraitsT_ char-traits
+     * @tparam AllocT_ allocator
+     * @param chars the characters
+     */
+    template <typename CharT_, typename TraitsT_, typename AllocT_>
+    constexpr explicit CharSet(std::basic_string<CharT_, TraitsT_, AllocT_> const &chars)
+        : CharSet(std::basic_string_view<CharT_, TraitsT_>{chars})
+    {
+    }
+
+    /**
+     * @brief Construct a set from all characters of a string literal (without the terminating null).
+     *
+     * @tparam CharT_ char-type
+     * @tparam N_ size of the literal including the terminating null
+     * @param chars the literal
+     */
+    template <typename CharT_, std::size_t N_>
+    requires(std::is_integral_v<CharT_>)
+    constexpr explicit CharSet(CharT_ const (&chars)[N_])
+        : CharSet(std::basic_string_view<CharT_>{chars, N_ > 0UL && chars[N_ - 1UL] == CharT_{0} ? N_ - 1UL : N_})
+    {
+    }
+
+    /**
+     * @brief Add a character.
+     *
+     * @tparam CharT_ char-type
+     * @param c the character
+     * @return CharSet& the modified set
+     * @throw std::length_error if more than MAX_WIDE characters above 255 are added
+     */
+    template <typename CharT_> constexpr CharSet &insert(CharT_ c)
+    {
+        auto const code = codeOf(c);
+        if (code < 256U)
+        {
+            narrow_.insert(static_cast<uint8_t>(code));
+            return *this;
+        }
+        auto slot = slotOf(code);
+        while (wide_[slot] != 0U && wide_[slot] != code)
+        {
+            slot = (slot + 1UL) % WIDE_CAPACITY;
+        }
+        if (wide_[slot] == 0U)
+        {
+            if (wideCount_ == MAX_WIDE)
+            {
+                throw std::length_error("util::CharSet: too many characters above 255"); // NOSONAR
+            }
+            wide_[slot] = code;
+            wideCount_++;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Add all characters of another set.
+     *
+     * @param other the other set
+     * @return CharSet& the modified set
+     */
+    constexpr CharSet &insert(CharSet const &other)
+    {
+        other.narrow_.forEach([this](uint8_t b) { narrow_.insert(b); });
+        for (auto code: other.wide_)
+        {
+            if (code != 0U)
+            {
+                insert(code);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Union of two sets.
+     *
+     * @param lhs left-hand-side set
+     * @param rhs right-hand-side set
+     * @return CharSet set containing the characters of both
+     */
+    friend constexpr CharSet operator|(CharSet lhs, CharSet const &rhs)
+    {
+        return lhs.insert(rhs);
+    }
+
+    /**
+     * @brief Check whether a character is in the set.
+     *
+     * @tparam CharT_ char-type
+     * @param c the character
+     * @return true, if c is in the set, false otherwise
+     */
+    template <typename CharT_> [[nodiscard]] constexpr bool contains(CharT_ c) const
+    {
+        auto const code = codeOf(c);
+        if (code < 256U)
+        {
+            return narrow_.contains(static_cast<uint8_t>(code));
+        }
+        if (wideCount_ == 0UL)
+        {
+            return false;
+        }
+        for (auto slot = slotOf(code); wide_[slot] != 0U; slot = (slot + 1UL) % WIDE_CAPACITY)
+        {
+            if (wide_[slot] == code)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Number of characters in the set.
+     *
+     * @return std::size_t the count
+     */
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return narrow_.size() + wideCount_;
+    }
+
+    /**
+     * @brief Check whether the set is empty.
+     *
+     * @return true, if so, false otherwise
+     */
+    [[nodiscard]] constexpr bool empty() const
+    {
+        return size() == 0UL;
+    }
+
+    /**
+     * @brief The bitmap of all members below 256.
+     *
+     * @return detail::ByteSet const& the bitmap
+     */
+    [[nodiscard]] constexpr detail::ByteSet const &bytes() const
+    {
+        return narrow_;
+    }
+
+  private:
+    template <typename CharT_> static constexpr uint32_t codeOf(CharT_ c)
+    {
+        return static_cast<uint32_t>(static_cast<std::make_unsigned_t<CharT_>>(c));
+    }
+
+    static constexpr std::size_t slotOf(uint32_t code)
+    {
+        // Fibonacci hashing: the top 6 bits of the product index the 64 slots
+        return static_cast<std::size_t>((code * 0x9E3779B1U) >> 26U);
+    }
+
+    detail::ByteSet                     narrow_;
+    std::array<uint32_t, WIDE_CAPACITY> wide_{}; ///< 0 marks an empty slot, as 0 is never a wide code
+    std::size_t                         wideCount_ = 0UL;
+};
+
+static_assert(CharSet::WIDE_CAPACITY == 64UL, "slotOf() assumes 64 slots");
+
+/**
+ * @brief Predefined character classes, following the classification of the "C" locale.
+ */
+namespace CharClass
+{
+inline constexpr CharSet WHITESPACE{" \t\n\v\f\r"};
+inline constexpr CharSet BLANK{" \t"};
+inline constexpr CharSet DIGIT{"0123456789"};
+inline constexpr CharSet XDIGIT{"0123456789abcdefABCDEF"};
+inline constexpr CharSet LOWER{"abcdefghijklmnopqrstuvwxyz"};
+inline constexpr CharSet UPPER{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+inline constexpr CharSet ALPHA = LOWER | UPPER;
+inline constexpr CharSet ALNUM = ALPHA | DIGIT;
+inline constexpr CharSet PUNCT{"!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"};
+} // namespace CharClass
+} // namespace util
+
+#endif // NS_UTIL_CHAR_SET_H_INCLUDED
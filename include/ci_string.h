@@ -25,12 +25,15 @@
 #ifndef NS_UTIL_CI_STRING_H_INCLUDED
 #define NS_UTIL_CI_STRING_H_INCLUDED
 
+#include "searcher.h"
 #include "stringutil.h"
 #include "to_string.h"
 
 #include <dkyb/traits.h>
 // #define DO_TRACE_ // NOSONAR
 #include <dkyb/traceutil.h>
+#include <string>
+#include <string_view>
 
 namespace util
 {
@@ -167,6 +170,15 @@ using ci_string = std::basic_string<char, ci_char_traits<char>, std::allocator<c
  */
 using ci_wstring = std::basic_string<wchar_t, ci_char_traits<wchar_t>, std::allocator<wchar_t>>;
 
+/**
+ * @brief Case-insensitive @c char string-view type.
+ */
+using ci_string_view = std::basic_string_view<char, ci_char_traits<char>>;
+/**
+ * @brief Case-insensitive @c wchar_t string-view type.
+ */
+using ci_wstring_view = std::basic_string_view<wchar_t, ci_char_traits<wchar_t>>;
+
 #ifdef _GLIBCXX_USE_CHAR8_T
 /**
  * @brief Case-insensitive  @c char8_t
@@ -266,6 +278,46 @@ inline std::basic_ostream<char32_t, std::char_traits<char32_t>> &
 }
 #endif
 
+/**
+ * @brief Find the first occurrence of a needle in a string or view, ignoring the case like util::ci_char_traits,
+ *        whatever the traits of the string. Byte-sized strings compare ASCII letters in folded SIMD blocks and only
+ *        consult ci_char_traits for non-ASCII bytes; wider strings fold ASCII characters arithmetically.
+ *        To search for the same needle many times, construct a util::Searcher<CharT_, ci_char_traits<CharT_>> once.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam NeedleT_ needle type, either CharT_ or string-like
+ * @param haystack the string to search
+ * @param needle the character or string to search for
+ * @param pos the position to start the search at
+ * @return size_type position of the first occurrence, or npos if there is none
+ */
+template <typename StringT_, typename NeedleT_>
+typename detail::string_view_of_t<StringT_>::size_type ciFind(
+    StringT_ const                                        &haystack,
+    NeedleT_ const                                        &needle,
+    typename detail::string_view_of_t<StringT_>::size_type pos = 0UL
+)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<NeedleT_, typename detail::string_view_of_t<StringT_>::value_type>)
+{
+    using char_type   = typename detail::string_view_of_t<StringT_>::value_type;
+    using traits_type = ci_char_traits<char_type>;
+    using view_type   = std::basic_string_view<char_type, traits_type>;
+
+    auto const      view = detail::string_view_of_t<StringT_>{haystack};
+    view_type const ciHaystack{std::data(view), std::size(view)};
+    if constexpr (std::is_same_v<std::remove_cvref_t<NeedleT_>, char_type>)
+    {
+        return Searcher<char_type, traits_type>{view_type{&needle, 1UL}}.find(ciHaystack, pos);
+    }
+    else
+    {
+        Searcher<char_type, traits_type> const searcher{detail::asStringView<char_type, traits_type>(needle)};
+
+        return searcher.find(ciHaystack, pos);
+    }
+}
+
 }; // namespace util
 
 /**
@@ -276,8 +328,9 @@ template <> struct std::hash<util::ci_string>
 {
     std::size_t operator()(util::ci_string const &s) const
     {
-        std::hash<std::string> hasher;
-        auto                   strLower = util::convert<std::string>(util::toLower(s));
+        std::hash<std::string_view> hasher;
+        auto const                  lower    = util::toLower(s);
+        auto const                  strLower = std::string_view{std::data(lower), std::size(lower)};
         TRACE1(strLower);
         return hasher(strLower);
     }
@@ -291,8 +344,9 @@ template <> struct std::hash<util::ci_wstring>
 {
     std::size_t operator()(util::ci_wstring const &s) const
     {
-        std::hash<std::wstring> hasher;
-        auto                    strLower = util::convert<std::wstring>(util::toLower(s));
+        std::hash<std::wstring_view> hasher;
+        auto const                   lower    = util::toLower(s);
+        auto const                   strLower = std::wstring_view{std::data(lower), std::size(lower)};
         return hasher(strLower);
     }
 };
@@ -307,8 +361,9 @@ template <> struct std::hash<util::ci_u8string>
 {
     std::size_t operator()(util::ci_u8string const &s) const
     {
-        std::hash<std::u8string> hasher;
-        auto                     strLower = util::convert<std::u8string>(util::toLower(s));
+        std::hash<std::u8string_view> hasher;
+        auto const                    lower    = util::toLower(s);
+        auto const                    strLower = std::u8string_view{std::data(lower), std::size(lower)};
         return hasher(strLower);
     }
 };
@@ -325,8 +380,9 @@ template <> struct std::hash<util::ci_u16string>
 {
     std::size_t operator()(util::ci_u16string const &s) const
     {
-        std::hash<std::u16string> hasher;
-        auto                      strLower = util::convert<std::u16string>(util::toLower(s));
+        std::hash<std::u16string_view> hasher;
+        auto const                     lower    = util::toLower(s);
+        auto const                     strLower = std::u16string_view{std::data(lower), std::size(lower)};
         return hasher(strLower);
     }
 };
@@ -339,8 +395,9 @@ template <> struct std::hash<util::ci_u32string>
 {
     std::size_t operator()(util::ci_u32string const &s) const
     {
-        std::hash<std::u32string> hasher;
-        auto                      strLower = util::convert<std::u32string>(util::toLower(s));
+        std::hash<std::u32string_view> hasher;
+        auto const                     lower    = util::toLower(s);
+        auto const                     strLower = std::u32string_view{std::data(lower), std::size(lower)};
         return hasher(strLower);
     }
 };
@@ -26,9 +26,11 @@
 #define NS_UTIL_DECORATOR_H_INCLUDED
 
 #include "brackets.h"
+#include "transcode.h"
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <deque>
 #include <dkyb/traits.h>
 // #define DO_TRACE_ // NOSONAR
@@ -126,6 +128,11 @@ inline std::basic_ostream<CharT_, Traits_> &
 
 /**
  * @brief Convert a string type into another.
+ *        The code units of char-types of one byte are UTF-8, of two bytes UTF-16 and of four bytes UTF-32 (so wchar_t
+ *        is UTF-16 or UTF-32, depending on the platform). Between char-types of the same width (e.g. util::ci_string
+ *        to std::string), the code units are copied with a single allocation and memcpy. Between different widths,
+ *        the string is transcoded: a counting pass sizes the result, then ASCII runs are widened or narrowed with SIMD
+ *        and all other code points re-encoded; invalid code units are replaced by U+FFFD.
  *
  * @tparam StringToT_ string type to convert to
  * @tparam StringFromT_ string type to convert from
@@ -136,24 +143,45 @@ template <typename StringToT_, typename StringFrom_>
 requires util::is_std_string_v<StringToT_> && util::is_std_string_v<StringFrom_>
 StringToT_ convert(StringFrom_ const &from)
 {
-    StringToT_ to;
-
     using char_type_from = typename util::is_std_string<StringFrom_>::char_type;
-    std::ranges::transform(from, std::back_inserter(to), [](auto const &c) { return static_cast<char_type_from>(c); });
+    using char_type_to   = typename util::is_std_string<StringToT_>::char_type;
+
+    if constexpr (detail::utf_encoding_of_v<char_type_from> != detail::utf_encoding_of_v<char_type_to>)
+    {
+        return detail::transcoded<StringToT_>(std::data(from), std::size(from));
+    }
+    else
+    {
+        static_assert(sizeof(char_type_from) == sizeof(char_type_to));
+
+        // same code units, whatever the traits: one allocation and a memcpy
+        auto const size = std::size(from);
+        StringToT_ to;
+        to.resize_and_overwrite(size, [&from, size](char_type_to *dst, std::size_t) {
+            if (size > 0UL)
+            {
+                std::memcpy(dst, std::data(from), size * sizeof(char_type_to));
+            }
+            return size;
+        });
 
-    return to;
+        return to;
+    }
 }
 
+/**
+ * @brief Convert a string type into a std::basic_string of another char-type. Works like convert<StringToT_>().
+ *
+ * @tparam CharToT_ char-type to convert to
+ * @tparam StringFromT_ string type to convert from
+ * @param from the original string
+ * @return std::basic_string<CharToT_> the converted string
+ */
 template <typename CharToT_, typename StringFrom_>
 requires util::is_char_v<CharToT_> && util::is_std_string_v<StringFrom_>
 std::basic_string<CharToT_> convert(StringFrom_ const &from)
 {
-    std::basic_string<CharToT_> to;
-
-    using char_type_from = typename util::is_std_string<StringFrom_>::char_type;
-    std::ranges::transform(from, std::back_inserter(to), [](auto const &c) { return static_cast<char_type_from>(c); });
-
-    return to;
+    return convert<std::basic_string<CharToT_>>(from);
 }
 
 /**
@@ -0,0 +1,214 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/mapped_text_file.h
+ * Description: read-only memory-mapped text file with zero-copy line and field iteration
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_MAPPED_TEXT_FILE_H_INCLUDED
+#define NS_UTIL_MAPPED_TEXT_FILE_H_INCLUDED
+
+#include "stringutil.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+
+namespace util
+{
+/**
+ * @brief Read-only memory mapping of a text file.
+ *        The contents are a single std::string_view into the mapping, so lines and fields are views as well and
+ *        every stringutil function taking views (trimmedView, strippedView, splitView, ...) works on them without
+ *        copying a byte. Lines and fields follow the semantics of splitIntoVector: a file ending with the line
+ *        separator has an empty last line, and an empty file has exactly one empty line.
+ *        The kernel is advised to read ahead sequentially.
+ *        Views into the file are valid as long as the MappedTextFile they come from.
+ */
+class MappedTextFile
+{
+  public:
+    /**
+     * @brief Map a file.
+     *
+     * @param path path of the file
+     * @throw std::system_error if the file cannot be opened or mapped
+     */
+    explicit MappedTextFile(std::filesystem::path const &path)
+    {
+        auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throwError(errno, "open", path);
+        }
+        struct stat status{};
+        if (::fstat(fd, &status) != 0)
+        {
+            auto const error = errno;
+            ::close(fd);
+            throwError(error, "stat", path);
+        }
+        size_ = static_cast<std::size_t>(status.st_size);
+        // an empty file cannot be mapped, it is represented by an empty view
+        if (size_ > 0UL)
+        {
+            auto *const mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                auto const error = errno;
+                ::close(fd);
+                throwError(error, "map", path);
+            }
+            data_ = static_cast<char const *>(mapping);
+            ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        }
+        // the mapping stays valid without the descriptor
+        ::close(fd);
+    }
+
+    MappedTextFile(MappedTextFile const &)            = delete;
+    MappedTextFile &operator=(MappedTextFile const &) = delete;
+
+    MappedTextFile(MappedTextFile &&rhs) noexcept
+        : data_(std::exchange(rhs.data_, nullptr))
+        , size_(std::exchange(rhs.size_, 0UL))
+    {
+    }
+
+    MappedTextFile &operator=(MappedTextFile &&rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0UL);
+        }
+
+        return *this;
+    }
+
+    ~MappedTextFile()
+    {
+        unmap();
+    }
+
+    /**
+     * @brief The whole contents of the file.
+     *
+     * @return std::string_view view of the mapping
+     */
+    [[nodiscard]] std::string_view view() const
+    {
+        return std::string_view{data_ == nullptr ? "" : data_, size_};
+    }
+
+    /**
+     * @brief Size of the file.
+     *
+     * @return std::size_t the number of bytes
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief The lines of the file, as a lazy range of views.
+     *
+     * @tparam SeparatorT_ separator type, needs to be either char or string-like
+     * @param lineSep the line separator, when it is a string it must outlive the range
+     * @return SplitView<char> forward range of std::string_view
+     */
+    template <typename SeparatorT_ = char>
+    [[nodiscard]] auto lines(SeparatorT_ const &lineSep = '\n') const
+    requires(detail::is_separator_for_v<SeparatorT_, char>)
+    {
+        return splitView(view(), lineSep);
+    }
+
+    /**
+     * @brief The fields of all lines, as a lazy range of lines, each a lazy range of field views.
+     *        A string field separator is copied once into storage shared by all copies of the range; the rows refer
+     *        to that copy, so a row is only valid while the range (or a copy or moved-to range of it) is alive.
+     *
+     * @tparam FieldSeparatorT_ field separator type, needs to be either char or string-like
+     * @tparam LineSeparatorT_ line separator type, needs to be either char or string-like
+     * @param fieldSep the field separator
+     * @param lineSep the line separator, when it is a string it must outlive the range
+     * @return range of SplitView<char>
+     */
+    template <typename FieldSeparatorT_, typename LineSeparatorT_ = char>
+    [[nodiscard]] auto fields(FieldSeparatorT_ const &fieldSep, LineSeparatorT_ const &lineSep = '\n') const
+    requires(detail::is_separator_for_v<FieldSeparatorT_, char> && detail::is_separator_for_v<LineSeparatorT_, char>)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<FieldSeparatorT_>, char>)
+        {
+            return lines(lineSep)
+                   | std::views::transform([fieldSep](std::string_view line) { return splitView(line, fieldSep); });
+        }
+        else
+        {
+            // on the heap, so that moving the range does not move the separator the rows refer to
+            auto const sep =
+                std::make_shared<std::string const>(detail::asStringView<char, std::char_traits<char>>(fieldSep));
+
+            return lines(lineSep) | std::views::transform([sep](std::string_view line) {
+                       return splitView(line, std::string_view{*sep});
+                   });
+        }
+    }
+
+  private:
+    [[noreturn]] static void throwError(int error, std::string const &action, std::filesystem::path const &path)
+    {
+        throw std::system_error( // NOSONAR
+            error,
+            std::generic_category(),
+            "util::MappedTextFile: cannot " + action + " '" + path.string() + "'"
+        );
+    }
+
+    void unmap() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char *>(data_), size_); // NOSONAR munmap takes a non-const pointer
+            data_ = nullptr;
+        }
+    }
+
+    char const *data_ = nullptr;
+    std::size_t size_ = 0UL;
+};
+} // namespace util
+
+#endif // NS_UTIL_MAPPED_TEXT_FILE_H_INCLUDED
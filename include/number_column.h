@@ -0,0 +1,230 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/number_column.h
+ * Description: infer the number class of whole columns of strings, optionally on several threads
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_NUMBER_COLUMN_H_INCLUDED
+#define NS_UTIL_NUMBER_COLUMN_H_INCLUDED
+
+#include "bulk_executor.h"
+#include "simd_kernels.h"
+#include "stringutil.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace util
+{
+/**
+ * @brief Number classes of a column of strings.
+ */
+struct NumberColumnClass
+{
+    NumberClass              widest = NumberClass::NONE; ///< narrowest class all cells can be converted to
+    std::vector<NumberClass> cells;                      ///< class of each cell, as classifyNumberString
+};
+
+namespace detail
+{
+/**
+ * @brief Smallest number of cells worth a task of its own; smaller columns are classified serially.
+ */
+inline constexpr std::size_t NUMBER_COLUMN_MIN_CHUNK = 16UL * 1'024UL;
+
+/**
+ * @brief Longest plain decimal classified without parsing; longer ones might exceed the range of double.
+ */
+inline constexpr std::size_t MAX_PLAIN_DECIMAL_LENGTH = 300UL;
+
+/**
+ * @brief Classes seen in a column, as bits, so that the summaries of chunks merge with a bitwise or.
+ */
+enum NumberColumnSeen : uint8_t
+{
+    SEEN_NONE         = 0x01,
+    SEEN_INT          = 0x02,
+    SEEN_NEGATIVE_INT = 0x04,
+    SEEN_UINT         = 0x08,
+    SEEN_FLOAT        = 0x10
+};
+
+/**
+ * @brief Classify a cell, telling negative integers apart.
+ *        Plain integers of up to 18 digits always fit into int64_t, and plain decimals of moderate length always
+ *        fit into double, so both are recognised by measuring their runs of digits with the SIMD kernels, without
+ *        parsing.
+ *        Everything else (exponents, long integers, non-numbers) is left to parseNumber().
+ *
+ * @param cell the string
+ * @return uint8_t the NumberColumnSeen bit of the cell's class
+ */
+inline uint8_t classifyCell(std::string_view cell)
+{
+    auto const *const bytes      = reinterpret_cast<unsigned char const *>(std::data(cell));
+    auto const        size       = std::size(cell);
+    auto const        signLength = size > 0UL && (cell[0] == '+' || cell[0] == '-') ? 1UL : 0UL;
+    auto const        intDigits  = digitRunLength(bytes + signLength, size - signLength);
+    auto const        intEnd     = signLength + intDigits;
+    if (intEnd == size && intDigits > 0UL && intDigits <= 18UL)
+    {
+        // "-0", "-00", ... are not negative
+        auto const isNegative = cell[0] == '-' && cell.find_first_not_of('0', 1UL) != std::string_view::npos;
+        return isNegative ? SEEN_NEGATIVE_INT : SEEN_INT;
+    }
+    if (intEnd < size && cell[intEnd] == '.' && size > signLength + 1UL && size <= MAX_PLAIN_DECIMAL_LENGTH
+        && digitRunLength(bytes + intEnd + 1UL, size - intEnd - 1UL) == size - intEnd - 1UL)
+    {
+        return SEEN_FLOAT;
+    }
+
+    auto const value = parseNumber(cell);
+    switch (numberClass(value))
+    {
+        case NumberClass::INT:
+            return std::get<int64_t>(value) < 0 ? SEEN_NEGATIVE_INT : SEEN_INT;
+        case NumberClass::UINT:
+            return SEEN_UINT;
+        case NumberClass::FLOAT:
+            return SEEN_FLOAT;
+        default:
+            return SEEN_NONE;
+    }
+}
+
+/**
+ * @brief Classify the cells [first, last) of a column into cells.
+ *
+ * @return uint8_t the NumberColumnSeen bits of all classes seen
+ */
+inline uint8_t classifyCells(
+    std::span<std::string_view const> column,
+    std::size_t                       first,
+    std::size_t                       last,
+    std::vector<NumberClass>         &cells
+)
+{
+    uint8_t seen = 0U;
+    for (auto index = first; index < last; index++)
+    {
+        auto const cellSeen = classifyCell(column[index]);
+        seen |= cellSeen;
+        switch (cellSeen)
+        {
+            case SEEN_INT:
+            case SEEN_NEGATIVE_INT:
+                cells[index] = NumberClass::INT;
+                break;
+            case SEEN_UINT:
+                cells[index] = NumberClass::UINT;
+                break;
+            case SEEN_FLOAT:
+                cells[index] = NumberClass::FLOAT;
+                break;
+            default:
+                cells[index] = NumberClass::NONE;
+                break;
+        }
+    }
+
+    return seen;
+}
+
+/**
+ * @brief The narrowest class all classes seen can be converted to: a negative INT and a UINT only fit together
+ *        into a FLOAT.
+ *
+ * @param seen NumberColumnSeen bits
+ * @return NumberClass the widest class
+ */
+inline NumberClass widestNumberClass(uint8_t seen)
+{
+    if ((seen & SEEN_NONE) != 0U || seen == 0U)
+    {
+        return NumberClass::NONE;
+    }
+    if ((seen & SEEN_FLOAT) != 0U || ((seen & SEEN_UINT) != 0U && (seen & SEEN_NEGATIVE_INT) != 0U))
+    {
+        return NumberClass::FLOAT;
+    }
+
+    return (seen & SEEN_UINT) != 0U ? NumberClass::UINT : NumberClass::INT;
+}
+} // namespace detail
+
+/**
+ * @brief Infer the number class of a column of strings, f.e. of a CSV file, on the tasks of a bulk executor.
+ *        Each cell is classified as by classifyNumberString(). The widest class of the column is NONE if any cell
+ *        is not a number (or the column is empty), otherwise the narrowest class all cells can be converted to.
+ *
+ * @tparam ExecutorT_ bulk executor, see is_bulk_executor_v
+ * @param column the cells of the column
+ * @param executor the executor running the tasks
+ * @return NumberColumnClass the widest class and the class of each cell
+ */
+template <typename ExecutorT_>
+NumberColumnClass classifyNumberColumn(std::span<std::string_view const> column, ExecutorT_ &&executor)
+requires(is_bulk_executor_v<std::remove_cvref_t<ExecutorT_>>)
+{
+    auto const chunkCount = std::min<std::size_t>(
+        executor.concurrency(),
+        std::max(1UL, std::size(column) / detail::NUMBER_COLUMN_MIN_CHUNK)
+    );
+    auto const chunkSize = (std::size(column) + chunkCount - 1UL) / chunkCount;
+
+    NumberColumnClass    reval{NumberClass::NONE, std::vector<NumberClass>(std::size(column))};
+    std::vector<uint8_t> seen(chunkCount, 0U);
+    executor.bulk(chunkCount, [&](std::size_t chunk) {
+        auto const first = std::min(chunk * chunkSize, std::size(column));
+        auto const last  = std::min(first + chunkSize, std::size(column));
+        seen[chunk]      = detail::classifyCells(column, first, last, reval.cells);
+    });
+    uint8_t allSeen = 0U;
+    for (auto chunkSeen: seen)
+    {
+        allSeen |= chunkSeen;
+    }
+    reval.widest = detail::widestNumberClass(allSeen);
+
+    return reval;
+}
+
+/**
+ * @brief Infer the number class of a column of strings on the given number of threads.
+ *
+ * @param column the cells of the column
+ * @param threadCount number of threads, defaults to 1
+ * @return NumberColumnClass the widest class and the class of each cell
+ */
+inline NumberColumnClass classifyNumberColumn(std::span<std::string_view const> column, std::size_t threadCount = 1UL)
+{
+    return classifyNumberColumn(column, ThreadExecutor{threadCount});
+}
+} // namespace util
+
+#endif // NS_UTIL_NUMBER_COLUMN_H_INCLUDED
@@ -0,0 +1,216 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/parallel_split.h
+ * Description: split very large buffers on several cores, with the exact results of splitIntoVector
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_PARALLEL_SPLIT_H_INCLUDED
+#define NS_UTIL_PARALLEL_SPLIT_H_INCLUDED
+
+#include "bulk_executor.h"
+#include "stringutil.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace util
+{
+namespace detail
+{
+/**
+ * @brief Smallest chunk worth a task of its own; smaller buffers are split serially.
+ */
+inline constexpr std::size_t PARALLEL_SPLIT_MIN_CHUNK = 256UL * 1'024UL;
+
+/**
+ * @brief Check whether two occurrences of a separator can overlap, i.e. whether a proper prefix of it equals a suffix.
+ *        Only then can an occurrence found by searching from an arbitrary position differ from the ones found by
+ *        the left-to-right search of the serial split.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @param sep the separator
+ * @return true, if occurrences can overlap, false otherwise
+ */
+template <typename ViewT_> bool isSelfOverlapping(ViewT_ sep)
+{
+    for (std::size_t border = 1UL; border < std::size(sep); border++)
+    {
+        if (sep.substr(0UL, border) == sep.substr(std::size(sep) - border))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Cut view into at most chunkCount chunks that end right before, and start right after, a separator.
+ *        Splitting the chunks independently and concatenating the tokens gives exactly the tokens of the whole view.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param view the buffer
+ * @param sep the separator
+ * @param chunkCount the desired number of chunks
+ * @return std::vector<ViewT_> the chunks, in order
+ */
+template <typename ViewT_, typename SeparatorT_>
+std::vector<ViewT_> separatorAlignedChunks(ViewT_ view, SeparatorT_ const &sep, std::size_t chunkCount)
+{
+    using char_type   = typename ViewT_::value_type;
+    using traits_type = typename ViewT_::traits_type;
+
+    auto sepView = ViewT_{};
+    auto sepChar = char_type{};
+    if constexpr (std::is_same_v<std::remove_cvref_t<SeparatorT_>, char_type>)
+    {
+        sepChar = sep;
+        sepView = ViewT_{&sepChar, 1UL};
+    }
+    else
+    {
+        sepView = asStringView<char_type, traits_type>(sep);
+    }
+
+    std::vector<ViewT_> chunks;
+    if (chunkCount < 2UL || sepView.empty() || isSelfOverlapping(sepView))
+    {
+        chunks.push_back(view);
+        return chunks;
+    }
+
+    Searcher<char_type, traits_type> const searcher{sepView};
+    std::size_t                            start = 0UL;
+    for (std::size_t chunk = 1UL; chunk < chunkCount && start < std::size(view); chunk++)
+    {
+        auto const nominal = std::max(start, std::size(view) / chunkCount * chunk);
+        auto const found   = searcher.find(view, nominal);
+        if (found == ViewT_::npos)
+        {
+            break;
+        }
+        chunks.push_back(view.substr(start, found - start));
+        start = found + std::size(sepView);
+    }
+    chunks.push_back(view.substr(start));
+
+    return chunks;
+}
+} // namespace detail
+
+/**
+ * @brief Split a very large buffer on all cores of an executor.
+ *        The buffer is cut into chunks at separators, every chunk is counted and then tokenised by its own task
+ *        directly into its slice of the result, so the tokens are in order without any stitching copies.
+ *        The result is exactly that of splitIntoVector(buffer, sep), including all empty tokens.
+ *        Separators whose occurrences can overlap (f.e. "aa") are split serially, to keep the serial semantics.
+ *
+ * @tparam TokenT_ type of the tokens, std::basic_string_view<...> (the default) for views into buffer, or an owning
+ *                 string-type constructible from it
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @tparam ExecutorT_ bulk executor, see is_bulk_executor_v
+ * @param buffer the buffer to split, must outlive the result if TokenT_ is a view
+ * @param sep the separator
+ * @param executor the executor running the tasks
+ * @return std::vector<TokenT_> the tokens
+ */
+template <
+    typename TokenT_ = void,
+    typename StringT_,
+    typename SeparatorT_,
+    typename ExecutorT_,
+    typename ResultT_ = std::conditional_t<std::is_void_v<TokenT_>, detail::string_view_of_t<StringT_>, TokenT_>>
+std::vector<ResultT_> parallelSplit(StringT_ const &buffer, SeparatorT_ const &sep, ExecutorT_ &&executor)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>
+         && is_bulk_executor_v<std::remove_cvref_t<ExecutorT_>>
+         && std::is_constructible_v<ResultT_, detail::string_view_of_t<StringT_>>)
+{
+    using view_type = detail::string_view_of_t<StringT_>;
+
+    auto const view       = view_type{buffer};
+    auto const chunkCount = std::min<std::size_t>(
+        executor.concurrency(),
+        std::max(1UL, std::size(view) / detail::PARALLEL_SPLIT_MIN_CHUNK)
+    );
+    auto const chunks = detail::separatorAlignedChunks(view, sep, chunkCount);
+
+    std::vector<std::size_t> offsets(std::size(chunks) + 1UL, 0UL);
+    executor.bulk(std::size(chunks), [&](std::size_t chunk) {
+        std::size_t count = 0UL;
+        detail::forEachToken(chunks[chunk], sep, [&count](view_type) { count++; });
+        offsets[chunk + 1UL] = count;
+    });
+    for (std::size_t chunk = 0UL; chunk < std::size(chunks); chunk++)
+    {
+        offsets[chunk + 1UL] += offsets[chunk];
+    }
+
+    std::vector<ResultT_> results(offsets.back());
+    executor.bulk(std::size(chunks), [&](std::size_t chunk) {
+        auto offset = offsets[chunk];
+        detail::forEachToken(chunks[chunk], sep, [&results, &offset](view_type token) {
+            results[offset++] = ResultT_(token);
+        });
+    });
+
+    return results;
+}
+
+/**
+ * @brief Split a very large buffer on the given number of threads.
+ *
+ * @tparam TokenT_ type of the tokens, std::basic_string_view<...> (the default) or an owning string-type
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param buffer the buffer to split, must outlive the result if TokenT_ is a view
+ * @param sep the separator
+ * @param threadCount number of threads, defaults to the number of hardware threads
+ * @return std::vector<TokenT_> the tokens
+ */
+template <typename TokenT_ = void, typename StringT_, typename SeparatorT_>
+auto parallelSplit(
+    StringT_ const    &buffer,
+    SeparatorT_ const &sep,
+    std::size_t        threadCount = std::thread::hardware_concurrency()
+)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
+{
+    return parallelSplit<TokenT_>(buffer, sep, ThreadExecutor{threadCount});
+}
+
+/**
+ * @brief Temporary buffers are not allowed, as views into them would dangle.
+ */
+template <typename TokenT_ = void, typename CharT_, typename TraitsT_, typename AllocT_, typename... ArgsT_>
+void parallelSplit(std::basic_string<CharT_, TraitsT_, AllocT_> &&, ArgsT_ &&...) = delete;
+} // namespace util
+
+#endif // NS_UTIL_PARALLEL_SPLIT_H_INCLUDED
@@ -0,0 +1,527 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/replace_all.h
+ * Description: replace several substrings at once in linear time with an Aho-Corasick automaton
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_REPLACE_ALL_H_INCLUDED
+#define NS_UTIL_REPLACE_ALL_H_INCLUDED
+
+#include "ci_string.h"
+#include "simd_kernels.h"
+#include "stringutil.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util
+{
+namespace detail
+{
+/**
+ * @brief Number of bytes appendChars copies at once when there is room for it.
+ */
+inline constexpr std::size_t WILD_COPY_SIZE = 16UL;
+
+/**
+ * @brief Copy n characters and return the end of the copy.
+ *        Replacements and the gaps between matches are mostly short: where source and destination have room for
+ *        WILD_COPY_SIZE bytes, such a copy is a single fixed-size memcpy, of which only the first n characters
+ *        count, rather than a call of memmove with a length that mispredicts.
+ *
+ * @tparam CharT_ char-type
+ * @param src source characters
+ * @param n number of characters
+ * @param dst destination, not overlapping src
+ * @param srcEnd end of the readable source characters
+ * @param dstEnd end of the writable destination characters
+ * @return CharT_* dst + n
+ */
+template <typename CharT_>
+CharT_ *appendChars(CharT_ const *src, std::size_t n, CharT_ *dst, CharT_ const *srcEnd, CharT_ const *dstEnd)
+{
+    constexpr std::size_t wildChars = WILD_COPY_SIZE / sizeof(CharT_);
+    if (n <= wildChars && srcEnd - src >= std::ptrdiff_t(wildChars) && dstEnd - dst >= std::ptrdiff_t(wildChars))
+    {
+        std::memcpy(dst, src, WILD_COPY_SIZE);
+        return dst + n;
+    }
+
+    return std::copy(src, src + n, dst);
+}
+} // namespace detail
+
+/**
+ * @brief Prebuilt Aho-Corasick automaton over a list of (from, to) replacements, reusable for any number of strings.
+ *        Matching is leftmost-longest and non-overlapping: scanning from the left, the earliest match wins, and of
+ *        the matches starting there the longest; the scan resumes behind it. Replacements are never rescanned.
+ *        The automaton is a dense DFA over classes of code units: all code units that do not occur in a pattern
+ *        share one class, so the transition table stays small even for wide char-types. For byte-sized chars the
+ *        scan skips from the root to the next byte starting a pattern with the SIMD set-matcher.
+ *        Characters match through TraitsT_::eq, so an automaton with util::ci_char_traits folds case exactly like
+ *        util::ci_string.
+ *        Scanning is linear in the length of the string, plus at most the longest pattern length per match.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits used to match the patterns
+ */
+template <typename CharT_, typename TraitsT_ = std::char_traits<CharT_>> class ReplaceAutomaton
+{
+  public:
+    using pattern_view     = std::basic_string_view<CharT_>;
+    using replacement_type = std::pair<pattern_view, pattern_view>;
+
+    /**
+     * @brief Build the automaton.
+     *
+     * @param replacements (from, to) pairs; if the same pattern occurs more than once, its last replacement counts
+     * @throw std::invalid_argument if a pattern is empty
+     */
+    explicit ReplaceAutomaton(std::span<replacement_type const> replacements)
+    {
+        for (auto const &[from, to]: replacements)
+        {
+            if (std::empty(from))
+            {
+                throw std::invalid_argument("util::ReplaceAutomaton: empty pattern"); // NOSONAR
+            }
+            for (auto c: from)
+            {
+                addClass(c);
+            }
+        }
+        resolveClasses();
+        buildTrie(replacements);
+        buildTransitions();
+    }
+
+    /**
+     * @brief Build the automaton.
+     *
+     * @param replacements (from, to) pairs; if the same pattern occurs more than once, its last replacement counts
+     * @throw std::invalid_argument if a pattern is empty
+     */
+    ReplaceAutomaton(std::initializer_list<replacement_type> replacements)
+        : ReplaceAutomaton(std::span<replacement_type const>{std::data(replacements), std::size(replacements)})
+    {
+    }
+
+    /**
+     * @brief Call onMatch(start, end, index) for every match [start, end) of pattern index, in ascending order.
+     *
+     * @tparam Func_ callable taking three std::size_t
+     * @param text the characters to scan
+     * @param n number of characters
+     * @param onMatch callback receiving the matches
+     */
+    template <typename Func_> void forEachMatch(CharT_ const *text, std::size_t n, Func_ &&onMatch) const
+    {
+        constexpr auto  NO_MATCH  = std::numeric_limits<std::size_t>::max();
+        uint32_t const *table     = std::data(table_);
+        std::size_t     pos       = 0UL;
+        uint32_t        state     = ROOT;
+        std::size_t     bestStart = NO_MATCH;
+        std::size_t     bestEnd   = 0UL;
+        uint32_t        bestIndex = NONE;
+        while (true)
+        {
+            if constexpr (sizeof(CharT_) == 1UL)
+            {
+                // nothing is pending at the root, so the scan skips to the next character starting a pattern
+                if (state == ROOT)
+                {
+                    pos += detail::findFirstByteInSet(
+                        reinterpret_cast<unsigned char const *>(text) + pos,
+                        n - pos,
+                        startMatcher_
+                    );
+                }
+            }
+            if (pos < n)
+            {
+                state = table[state + FIRST_EDGE + classOf(text[pos++])];
+                if (auto const out = table[state + OUTPUT]; out != NONE)
+                {
+                    // the longest output has the earliest start; an equal start found later is a longer match
+                    auto const start = pos - patternLength_[out];
+                    if (start <= bestStart)
+                    {
+                        bestStart = start;
+                        bestEnd   = pos;
+                        bestIndex = out;
+                    }
+                }
+                // a later match could still start at or before the best one
+                if (bestStart == NO_MATCH || pos - table[state + DEPTH] <= bestStart)
+                {
+                    continue;
+                }
+            }
+            else if (bestStart == NO_MATCH)
+            {
+                break;
+            }
+            onMatch(bestStart, bestEnd, static_cast<std::size_t>(bestIndex));
+            // matches overlapping the replaced one are dropped by restarting behind it
+            pos       = bestEnd;
+            state     = ROOT;
+            bestStart = NO_MATCH;
+        }
+    }
+
+    /**
+     * @brief The replacement of a pattern.
+     *
+     * @param index index of the pattern, as passed to the onMatch-callback of forEachMatch
+     * @return pattern_view the replacement
+     */
+    [[nodiscard]] pattern_view replacement(std::size_t index) const
+    {
+        return pattern_view{std::data(pool_) + poolOffset_[index], poolOffset_[index + 1UL] - poolOffset_[index]};
+    }
+
+    /**
+     * @brief Copy the replacement of a pattern.
+     *
+     * @param index index of the pattern, as passed to the onMatch-callback of forEachMatch
+     * @param dst destination
+     * @param dstEnd end of the writable destination characters
+     * @return CharT_* the end of the copy
+     */
+    CharT_ *appendReplacement(std::size_t index, CharT_ *dst, CharT_ const *dstEnd) const
+    {
+        auto const    found   = replacement(index);
+        CharT_ const *poolEnd = std::data(pool_) + std::size(pool_);
+        // the pool is padded, so that every replacement can be copied with a fixed-size copy
+        return detail::appendChars(std::data(found), std::size(found), dst, poolEnd, dstEnd);
+    }
+
+    /**
+     * @brief Number of states of the automaton.
+     *
+     * @return std::size_t the number of states, the root included
+     */
+    [[nodiscard]] std::size_t stateCount() const
+    {
+        return std::size(table_) / stride_;
+    }
+
+  private:
+    // a state is the offset of its row in table_, which holds its depth, its output and its successors
+    static constexpr uint32_t ROOT       = 0U;
+    static constexpr uint32_t DEPTH      = 0U;
+    static constexpr uint32_t OUTPUT     = 1U;
+    static constexpr uint32_t FIRST_EDGE = 2U;
+    static constexpr uint32_t NONE       = std::numeric_limits<uint32_t>::max();
+
+    static std::make_unsigned_t<CharT_> indexOf(CharT_ c)
+    {
+        return static_cast<std::make_unsigned_t<CharT_>>(c);
+    }
+
+    /**
+     * @brief Register a pattern character, characters equal under TraitsT_ share a class.
+     */
+    void addClass(CharT_ c)
+    {
+        for (auto rep: representatives_)
+        {
+            if (TraitsT_::eq(rep, c))
+            {
+                return;
+            }
+        }
+        representatives_.push_back(c);
+    }
+
+    /**
+     * @brief Resolve the class of all values below 256 and sort the larger pattern characters for lookup.
+     *        Class 0 is that of all characters not occurring in any pattern.
+     */
+    void resolveClasses()
+    {
+        auto const classCount = static_cast<uint32_t>(std::size(representatives_)) + 1U;
+        stride_               = FIRST_EDGE + classCount;
+        for (std::size_t index = 0UL; index < std::size(byteClass_); ++index)
+        {
+            byteClass_[index] = findClass(static_cast<CharT_>(index));
+        }
+        if constexpr (sizeof(CharT_) > 1UL && std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+        {
+            for (uint32_t rep = 0U; rep < std::size(representatives_); ++rep)
+            {
+                if (indexOf(representatives_[rep]) >= 256U)
+                {
+                    wideClass_.emplace_back(representatives_[rep], rep + 1U);
+                }
+            }
+            std::sort(std::begin(wideClass_), std::end(wideClass_));
+        }
+    }
+
+    [[nodiscard]] uint32_t findClass(CharT_ c) const
+    {
+        for (uint32_t rep = 0U; rep < std::size(representatives_); ++rep)
+        {
+            if (TraitsT_::eq(representatives_[rep], c))
+            {
+                return rep + 1U;
+            }
+        }
+
+        return 0U;
+    }
+
+    [[nodiscard]] uint32_t classOf(CharT_ c) const
+    {
+        if constexpr (sizeof(CharT_) == 1UL)
+        {
+            return byteClass_[indexOf(c)];
+        }
+        else
+        {
+            if (indexOf(c) < 256U)
+            {
+                return byteClass_[indexOf(c)];
+            }
+            if constexpr (std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+            {
+                auto const found = std::lower_bound(
+                    std::begin(wideClass_),
+                    std::end(wideClass_),
+                    c,
+                    [](auto const &entry, CharT_ value) { return entry.first < value; }
+                );
+                return found != std::end(wideClass_) && found->first == c ? found->second : 0U;
+            }
+            else
+            {
+                return findClass(c);
+            }
+        }
+    }
+
+    uint32_t addState(uint32_t depth)
+    {
+        auto const state = static_cast<uint32_t>(std::size(table_));
+        table_.resize(std::size(table_) + stride_, NONE);
+        table_[state + DEPTH] = depth;
+
+        return state;
+    }
+
+    /**
+     * @brief Insert all patterns into the trie, whose edges are the first successors in the table.
+     */
+    void buildTrie(std::span<replacement_type const> replacements)
+    {
+        addState(0U);
+        for (auto const &replacement: replacements)
+        {
+            uint32_t state = ROOT;
+            for (auto c: replacement.first)
+            {
+                auto const edge = state + FIRST_EDGE + classOf(c);
+                if (table_[edge] == NONE)
+                {
+                    table_[edge] = addState(table_[state + DEPTH] + 1U);
+                }
+                state = table_[edge];
+            }
+            table_[state + OUTPUT] = static_cast<uint32_t>(std::size(patternLength_));
+            patternLength_.push_back(std::size(replacement.first));
+            poolOffset_.push_back(std::size(pool_));
+            pool_.append(replacement.second);
+        }
+        poolOffset_.push_back(std::size(pool_));
+        pool_.append(detail::WILD_COPY_SIZE / sizeof(CharT_), CharT_{});
+    }
+
+    /**
+     * @brief Complete the trie to a DFA with the failure links, breadth-first, and let every state output the
+     *        longest pattern that is a suffix of it.
+     */
+    void buildTransitions()
+    {
+        std::vector<uint32_t>    fail(stateCount(), ROOT); ///< failure link of each state, by state number
+        std::vector<bool>        startsPattern(stride_ - FIRST_EDGE, false);
+        std::deque<uint32_t>     queue;
+        for (uint32_t cls = 0U; cls < stride_ - FIRST_EDGE; ++cls)
+        {
+            auto &next = table_[ROOT + FIRST_EDGE + cls];
+            if (next == NONE)
+            {
+                next = ROOT;
+            }
+            else
+            {
+                startsPattern[cls] = true;
+                queue.push_back(next);
+            }
+        }
+        while (!queue.empty())
+        {
+            auto const state = queue.front();
+            auto const link  = fail[state / stride_];
+            queue.pop_front();
+            if (table_[state + OUTPUT] == NONE)
+            {
+                table_[state + OUTPUT] = table_[link + OUTPUT];
+            }
+            for (uint32_t edge = FIRST_EDGE; edge < stride_; ++edge)
+            {
+                auto      &next     = table_[state + edge];
+                auto const fallback = table_[link + edge];
+                if (next == NONE)
+                {
+                    next = fallback;
+                }
+                else
+                {
+                    fail[next / stride_] = fallback;
+                    queue.push_back(next);
+                }
+            }
+        }
+
+        detail::ByteSet starts;
+        for (std::size_t index = 0UL; index < std::size(byteClass_); ++index)
+        {
+            if (startsPattern[byteClass_[index]])
+            {
+                starts.insert(static_cast<uint8_t>(index));
+            }
+        }
+        startMatcher_ = detail::ByteSetMatcher{starts};
+    }
+
+    std::vector<CharT_>                      representatives_; ///< one character of each class but class 0
+    std::array<uint32_t, 256>                byteClass_{};
+    std::vector<std::pair<CharT_, uint32_t>> wideClass_; ///< sorted classes of larger values, with std::char_traits
+    uint32_t                                 stride_ = FIRST_EDGE + 1U;
+    std::vector<uint32_t>                    table_;
+    detail::ByteSetMatcher                   startMatcher_{detail::ByteSet{}}; ///< bytes starting a pattern
+    std::vector<std::size_t>                 patternLength_;
+    std::vector<std::size_t>                 poolOffset_; ///< replacement i is [poolOffset_[i], poolOffset_[i + 1])
+    std::basic_string<CharT_>                pool_;       ///< all replacements, padded for appendChars
+};
+
+/**
+ * @brief Replace all matches of a prebuilt automaton in a string.
+ *        The size of the result is computed in a first scan, so that the result is written with a single allocation
+ *        in the second; a string without matches is left untouched without allocating.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam TraitsT_ char-traits of the automaton
+ * @param str the string to modify
+ * @param automaton the replacements
+ */
+template <typename StringT_, typename TraitsT_>
+void replaceAll(StringT_ &str, ReplaceAutomaton<typename StringT_::value_type, TraitsT_> const &automaton)
+requires(util::is_std_string_v<StringT_>)
+{
+    using char_type = typename StringT_::value_type;
+
+    std::size_t matchCount = 0UL;
+    std::size_t resultSize = std::size(str);
+    automaton.forEachMatch(std::data(str), std::size(str), [&](std::size_t start, std::size_t end, std::size_t index) {
+        matchCount++;
+        resultSize = resultSize - (end - start) + std::size(automaton.replacement(index));
+    });
+    if (matchCount == 0UL)
+    {
+        return;
+    }
+
+    StringT_ result(str.get_allocator());
+    result.resize_and_overwrite(resultSize, [&](char_type *out, std::size_t) {
+        char_type const *src    = std::data(str);
+        char_type const *srcEnd = src + std::size(str);
+        char_type const *outEnd = out + resultSize;
+        std::size_t      copied = 0UL;
+        automaton.forEachMatch(src, std::size(str), [&](std::size_t start, std::size_t end, std::size_t index) {
+            out    = detail::appendChars(src + copied, start - copied, out, srcEnd, outEnd);
+            out    = automaton.appendReplacement(index, out, outEnd);
+            copied = end;
+        });
+        std::copy(src + copied, src + std::size(str), out);
+        return resultSize;
+    });
+    str.swap(result);
+}
+
+/**
+ * @brief Replace all occurrences of several substrings at once, matching with the traits of the string.
+ *        util::ci_string therefore replaces case-insensitively.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the string to modify
+ * @param replacements (from, to) pairs, f.e. {{"&", "&amp;"}, {"<", "&lt;"}}
+ * @throw std::invalid_argument if a pattern is empty
+ */
+template <typename StringT_>
+void replaceAll(
+    StringT_ &str,
+    std::initializer_list<typename ReplaceAutomaton<typename StringT_::value_type>::replacement_type> replacements
+)
+requires(util::is_std_string_v<StringT_>)
+{
+    ReplaceAutomaton<typename StringT_::value_type, typename StringT_::traits_type> const automaton{replacements};
+    replaceAll(str, automaton);
+}
+
+/**
+ * @brief Replace all occurrences of several substrings at once, ignoring case like util::ci_char_traits.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the string to modify
+ * @param replacements (from, to) pairs
+ * @throw std::invalid_argument if a pattern is empty
+ */
+template <typename StringT_>
+void ciReplaceAll(
+    StringT_ &str,
+    std::initializer_list<typename ReplaceAutomaton<typename StringT_::value_type>::replacement_type> replacements
+)
+requires(util::is_std_string_v<StringT_>)
+{
+    using char_type = typename StringT_::value_type;
+
+    ReplaceAutomaton<char_type, ci_char_traits<char_type>> const automaton{replacements};
+    replaceAll(str, automaton);
+}
+} // namespace util
+
+#endif // NS_UTIL_REPLACE_ALL_H_INCLUDED
@@ -0,0 +1,299 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/searcher.h
+ * Description: precompiled single-pattern substring search
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_SEARCHER_H_INCLUDED
+#define NS_UTIL_SEARCHER_H_INCLUDED
+
+#include "simd_kernels.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace util
+{
+/**
+ * @brief Precompiled search for one needle, matched with the traits TraitsT_, in any number of haystacks.
+ *        The algorithm is chosen once, when the searcher is constructed:
+ *        - a single character is found with TraitsT_::find (memchr for std::char_traits<char>),
+ *        - needles of up to MAX_FILTERED_LENGTH bytes matched with std::char_traits are found by the SIMD
+ *          first/last-byte filter, which verifies only the positions where both the first and the last byte match,
+ *        - needles of up to MAX_FILTERED_LENGTH bytes matched with case-folding traits (traits with a static
+ *          toUpperChar(), like util::ci_char_traits) are found by the same filter on ASCII-folded bytes, which only
+ *          asks the traits about non-ASCII bytes,
+ *        - all other needles are found with Boyer-Moore-Horspool, whose shifts are looked up by the low byte of the
+ *          character, so that the table has 256 entries for every char-type. With traits other than
+ *          std::char_traits, the shifts take all characters equal under TraitsT_::eq into account, so that
+ *          f.e. util::ci_char_traits finds both cases. Case-folding traits compare ASCII characters arithmetically.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits used to match the needle
+ */
+template <typename CharT_, typename TraitsT_ = std::char_traits<CharT_>> class Searcher
+{
+  public:
+    using view_type = std::basic_string_view<CharT_, TraitsT_>;
+    using size_type = typename view_type::size_type;
+
+    static constexpr size_type   npos                = view_type::npos;
+    static constexpr std::size_t MAX_FILTERED_LENGTH = 32UL;
+
+    /**
+     * @brief Construct a searcher for the empty needle, which is found at every position.
+     */
+    Searcher() = default;
+
+    /**
+     * @brief Construct a searcher.
+     *
+     * @param needle the characters to search for, must outlive the searcher
+     */
+    explicit Searcher(view_type needle)
+        : needle_(needle)
+    {
+        auto const m = std::size(needle_);
+        if (m == 0UL)
+        {
+            strategy_ = Strategy::EMPTY;
+        }
+        else if (m == 1UL && !IS_CASE_FOLDING)
+        {
+            strategy_ = Strategy::SINGLE;
+        }
+        else if (IS_PLAIN_BYTES && m <= MAX_FILTERED_LENGTH)
+        {
+            strategy_ = Strategy::FILTER;
+        }
+        else if (IS_FOLDED_BYTES && m <= MAX_FILTERED_LENGTH)
+        {
+            strategy_ = Strategy::FOLDED;
+        }
+        else
+        {
+            strategy_ = Strategy::HORSPOOL;
+            initialiseShifts();
+        }
+    }
+
+    /**
+     * @brief Find the first occurrence of the needle at or after a position, like std::basic_string_view::find.
+     *
+     * @param haystack the characters to search
+     * @param pos the position to start the search at
+     * @return size_type position of the first occurrence, or npos if there is none
+     */
+    [[nodiscard]] size_type find(view_type haystack, size_type pos = 0UL) const
+    {
+        if (pos > std::size(haystack))
+        {
+            return npos;
+        }
+        CharT_ const *data = std::data(haystack) + pos;
+        auto const    n    = std::size(haystack) - pos;
+        size_type     found{};
+        switch (strategy_)
+        {
+            case Strategy::EMPTY:
+                return pos;
+            case Strategy::SINGLE:
+                if (auto const *at = TraitsT_::find(data, n, needle_.front()); at != nullptr)
+                {
+                    return static_cast<size_type>(at - std::data(haystack));
+                }
+                return npos;
+            case Strategy::FILTER:
+                found = detail::findBytes(
+                    reinterpret_cast<unsigned char const *>(data),
+                    n,
+                    reinterpret_cast<unsigned char const *>(std::data(needle_)),
+                    std::size(needle_)
+                );
+                break;
+            case Strategy::FOLDED:
+                found = detail::findBytesIgnoringAsciiCase(
+                    reinterpret_cast<unsigned char const *>(data),
+                    n,
+                    reinterpret_cast<unsigned char const *>(std::data(needle_)),
+                    std::size(needle_),
+                    [](unsigned char lhs, unsigned char rhs) {
+                        return TraitsT_::eq(static_cast<CharT_>(lhs), static_cast<CharT_>(rhs));
+                    }
+                );
+                break;
+            case Strategy::HORSPOOL:
+                found = horspool(data, n);
+                break;
+        }
+
+        return found == n ? npos : pos + found;
+    }
+
+    /**
+     * @brief The needle the searcher looks for.
+     *
+     * @return view_type the needle
+     */
+    [[nodiscard]] view_type needle() const
+    {
+        return needle_;
+    }
+
+  private:
+    enum class Strategy : uint8_t
+    {
+        EMPTY,
+        SINGLE,
+        FILTER,
+        FOLDED,
+        HORSPOOL
+    };
+
+    static constexpr bool IS_PLAIN_BYTES  = sizeof(CharT_) == 1UL && std::is_same_v<TraitsT_, std::char_traits<CharT_>>;
+    static constexpr bool IS_CASE_FOLDING = requires(CharT_ c) { TraitsT_::toUpperChar(c); };
+    static constexpr bool IS_FOLDED_BYTES = sizeof(CharT_) == 1UL && IS_CASE_FOLDING;
+
+    static constexpr uint8_t lowByte(CharT_ c)
+    {
+        return static_cast<uint8_t>(static_cast<std::make_unsigned_t<CharT_>>(c) & 0xFFU);
+    }
+
+    /**
+     * @brief Fill the shift table: the shift for a character is the distance of its last occurrence before the end
+     *        of the needle to the end, capped at 255. Characters sharing a low byte share the smallest shift.
+     */
+    void initialiseShifts()
+    {
+        auto const m = std::size(needle_);
+        shift_.fill(static_cast<uint8_t>(std::min(m, std::size_t{255UL})));
+        for (std::size_t j = 0UL; j + 1UL < m; ++j)
+        {
+            auto const distance = static_cast<uint8_t>(std::min(m - 1UL - j, std::size_t{255UL}));
+            if constexpr (std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+            {
+                shift_[lowByte(needle_[j])] = distance;
+            }
+            else if (IS_CASE_FOLDING && detail::isAsciiChar(needle_[j]))
+            {
+                // ASCII characters are only equal to their own case-variants
+                shift_[lowByte(detail::asciiCaseChar<detail::LetterCase::LOWER>(needle_[j]))] = distance;
+                shift_[lowByte(detail::asciiCaseChar<detail::LetterCase::UPPER>(needle_[j]))] = distance;
+            }
+            else
+            {
+                for (std::size_t index = 0UL; index < std::size(shift_); ++index)
+                {
+                    if (TraitsT_::eq(static_cast<CharT_>(index), needle_[j]))
+                    {
+                        shift_[index] = distance;
+                    }
+                }
+                shift_[lowByte(needle_[j])] = distance;
+            }
+        }
+    }
+
+    /**
+     * @brief Equality of two characters under TraitsT_, short-cutting case-folding traits for ASCII characters.
+     *
+     * @param lhs first character
+     * @param rhs second character
+     * @return true if the characters are equal, false otherwise
+     */
+    static bool charsEqual(CharT_ lhs, CharT_ rhs)
+    {
+        if constexpr (IS_CASE_FOLDING)
+        {
+            if (detail::isAsciiChar(lhs) && detail::isAsciiChar(rhs))
+            {
+                return detail::asciiCaseChar<detail::LetterCase::LOWER>(lhs)
+                       == detail::asciiCaseChar<detail::LetterCase::LOWER>(rhs);
+            }
+        }
+
+        return TraitsT_::eq(lhs, rhs);
+    }
+
+    [[nodiscard]] std::size_t shiftOf(CharT_ c) const
+    {
+        if constexpr (sizeof(CharT_) > 1UL && !std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+        {
+            // characters above 255 may be equal to needle characters with any low byte
+            if (static_cast<std::make_unsigned_t<CharT_>>(c) > 0xFFU)
+            {
+                return 1UL;
+            }
+        }
+
+        return shift_[lowByte(c)];
+    }
+
+    /**
+     * @brief Boyer-Moore-Horspool search.
+     *
+     * @param data the characters to search
+     * @param n number of characters
+     * @return std::size_t position of the first occurrence, or n if there is none
+     */
+    [[nodiscard]] std::size_t horspool(CharT_ const *data, std::size_t n) const
+    {
+        auto const m = std::size(needle_);
+        if (m > n)
+        {
+            return n;
+        }
+        auto const    lastChar = needle_[m - 1UL];
+        CharT_ const *needle   = std::data(needle_);
+        for (std::size_t i = 0UL; i <= n - m;)
+        {
+            auto const c = data[i + m - 1UL];
+            if (charsEqual(c, lastChar))
+            {
+                std::size_t j = 0UL;
+                while (j + 1UL < m && charsEqual(data[i + j], needle[j]))
+                {
+                    ++j;
+                }
+                if (j + 1UL == m)
+                {
+                    return i;
+                }
+            }
+            i += shiftOf(c);
+        }
+
+        return n;
+    }
+
+    view_type                needle_;
+    Strategy                 strategy_ = Strategy::EMPTY;
+    std::array<uint8_t, 256> shift_{}; ///< Horspool shift by the low byte of the character under the needle's end
+};
+} // namespace util
+
+#endif // NS_UTIL_SEARCHER_H_INCLUDED
@@ -0,0 +1,1792 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/simd_kernels.h
+ * Description: vectorised low-level kernels backing the string utility functions
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_SIMD_KERNELS_H_INCLUDED
+#define NS_UTIL_SIMD_KERNELS_H_INCLUDED
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwctype>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+namespace util::detail
+{
+/**
+ * @brief Width in bytes of the widest vector unit the kernels are compiled for.
+ *        AVX2 and SSE2 are selected at compile time, everything else uses 64-bit SWAR.
+ */
+#if defined(__AVX2__)
+inline constexpr std::size_t SIMD_BLOCK_SIZE = 32UL;
+#elif defined(__SSE2__)
+inline constexpr std::size_t SIMD_BLOCK_SIZE = 16UL;
+#else
+inline constexpr std::size_t SIMD_BLOCK_SIZE = 8UL;
+#endif
+
+/**
+ * @brief Target case of a case conversion.
+ */
+enum class LetterCase : int8_t
+{
+    LOWER, ///< convert to lower-case
+    UPPER  ///< convert to upper-case
+};
+
+/**
+ * @brief Broadcast a byte into all 8 bytes of a 64-bit word.
+ *
+ * @param b the byte
+ * @return uint64_t word with every byte set to b
+ */
+constexpr uint64_t broadcastByte(uint8_t b)
+{
+    return 0x01010101'01010101ULL * b;
+}
+
+/**
+ * @brief Check whether a character lies in the 7-bit ASCII range.
+ *
+ * @tparam CharT_ char-type
+ * @param c the character
+ * @return true, if c is ASCII, false otherwise
+ */
+template <typename CharT_> constexpr bool isAsciiChar(CharT_ c)
+{
+    return static_cast<std::make_unsigned_t<CharT_>>(c) < 0x80U;
+}
+
+/**
+ * @brief Case-convert an ASCII character arithmetically.
+ *
+ * @tparam Case_ target case
+ * @tparam CharT_ char-type
+ * @param c the character, must be ASCII
+ * @return CharT_ the converted character
+ */
+template <LetterCase Case_, typename CharT_> constexpr CharT_ asciiCaseChar(CharT_ c)
+{
+    if constexpr (Case_ == LetterCase::LOWER)
+    {
+        return (c >= CharT_{'A'} && c <= CharT_{'Z'}) ? static_cast<CharT_>(c | CharT_{0x20}) : c;
+    }
+    else
+    {
+        return (c >= CharT_{'a'} && c <= CharT_{'z'}) ? static_cast<CharT_>(c & ~CharT_{0x20}) : c;
+    }
+}
+
+/**
+ * @brief Case-convert a character through the C wide-character functions towlower/towupper.
+ *        This is the generic (locale-aware) path for non-ASCII characters.
+ *
+ * @tparam Case_ target case
+ * @tparam CharT_ char-type
+ * @param c the character
+ * @return CharT_ the converted character
+ */
+template <LetterCase Case_, typename CharT_> inline CharT_ wideCaseChar(CharT_ c)
+{
+    if constexpr (Case_ == LetterCase::LOWER)
+    {
+        return static_cast<CharT_>(towlower(static_cast<wchar_t>(c)));
+    }
+    else
+    {
+        return static_cast<CharT_>(towupper(static_cast<wchar_t>(c)));
+    }
+}
+
+/**
+ * @brief Case-convert one block of SIMD_BLOCK_SIZE bytes, if and only if the block is pure ASCII.
+ *
+ * @tparam Case_ target case
+ * @param src source block
+ * @param dst destination block, may be identical to src
+ * @return true, if the block was pure ASCII and has been converted, false otherwise (dst untouched)
+ */
+template <LetterCase Case_> inline bool asciiCaseBlock(unsigned char const *src, unsigned char *dst)
+{
+    constexpr char first = Case_ == LetterCase::LOWER ? 'A' : 'a';
+    constexpr char last  = Case_ == LetterCase::LOWER ? 'Z' : 'z';
+#if defined(__AVX2__)
+    __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+    if (_mm256_movemask_epi8(v) != 0)
+    {
+        return false;
+    }
+    // all bytes are in [0, 127] so signed compares are safe
+    __m256i const inRange = _mm256_and_si256(
+        _mm256_cmpgt_epi8(v, _mm256_set1_epi8(first - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), v)
+    );
+    __m256i const flip = _mm256_and_si256(inRange, _mm256_set1_epi8(0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_xor_si256(v, flip));
+#elif defined(__SSE2__)
+    __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+    if (_mm_movemask_epi8(v) != 0)
+    {
+        return false;
+    }
+    // all bytes are in [0, 127] so signed compares are safe
+    __m128i const inRange =
+        _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(last + 1)));
+    __m128i const flip = _mm_and_si128(inRange, _mm_set1_epi8(0x20));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(v, flip));
+#else
+    uint64_t word = 0ULL;
+    std::memcpy(&word, src, sizeof(word));
+    if ((word & broadcastByte(0x80)) != 0ULL)
+    {
+        return false;
+    }
+    // bit 7 of each byte in aboveFirst/aboveLast is set iff that byte is >= first / > last
+    uint64_t const aboveFirst = word + broadcastByte(0x80 - first);
+    uint64_t const aboveLast  = word + broadcastByte(0x80 - (last + 1));
+    uint64_t const inRange    = (aboveFirst ^ aboveLast) & broadcastByte(0x80);
+    word ^= inRange >> 2;
+    std::memcpy(dst, &word, sizeof(word));
+#endif
+    return true;
+}
+
+/**
+ * @brief Case-convert the ASCII letters of one block of SIMD_BLOCK_SIZE bytes, copying all other bytes unchanged.
+ *        Unlike asciiCaseBlock this converts mixed blocks as well, and reports where their non-ASCII bytes are.
+ *
+ * @tparam Case_ target case
+ * @param src source block
+ * @param dst destination block, may be identical to src
+ * @return uint64_t mask in which bit i is set iff src[i] is not ASCII
+ */
+template <LetterCase Case_> inline uint64_t asciiLetterCaseBlock(unsigned char const *src, unsigned char *dst)
+{
+    constexpr char first = Case_ == LetterCase::LOWER ? 'A' : 'a';
+    constexpr char last  = Case_ == LetterCase::LOWER ? 'Z' : 'z';
+#if defined(__AVX2__)
+    __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+    // non-ASCII bytes are negative as signed bytes, so they are never in range
+    __m256i const inRange = _mm256_and_si256(
+        _mm256_cmpgt_epi8(v, _mm256_set1_epi8(first - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), v)
+    );
+    __m256i const flip = _mm256_and_si256(inRange, _mm256_set1_epi8(0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_xor_si256(v, flip));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+#elif defined(__SSE2__)
+    __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+    // non-ASCII bytes are negative as signed bytes, so they are never in range
+    __m128i const inRange =
+        _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8(last + 1)));
+    __m128i const flip = _mm_and_si128(inRange, _mm_set1_epi8(0x20));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(v, flip));
+    return static_cast<uint32_t>(_mm_movemask_epi8(v));
+#else
+    uint64_t word = 0ULL;
+    std::memcpy(&word, src, sizeof(word));
+    uint64_t const high  = word & broadcastByte(0x80);
+    uint64_t const ascii = word & broadcastByte(0x7F);
+    // as in asciiCaseBlock, on the low 7 bits so that nothing carries, and non-ASCII bytes masked out
+    uint64_t const aboveFirst = ascii + broadcastByte(0x80 - first);
+    uint64_t const aboveLast  = ascii + broadcastByte(0x80 - (last + 1));
+    uint64_t const inRange    = (aboveFirst ^ aboveLast) & ~high & broadcastByte(0x80);
+    word ^= inRange >> 2;
+    std::memcpy(dst, &word, sizeof(word));
+    // gather bit 7 of byte k into bit 56 + k, as in byteMatchMask
+    return ((high >> 7U) * 0x01020408'10204080ULL) >> 56U;
+#endif
+}
+
+/**
+ * @brief Case-convert n characters from src to dst.
+ *        Byte-sized characters are processed in blocks of SIMD_BLOCK_SIZE; blocks that contain non-ASCII
+ *        bytes, and all non-ASCII characters of wider char-types, go through wideCaseChar, so the result
+ *        is identical to converting every character with towlower/towupper.
+ *
+ * @tparam Case_ target case
+ * @tparam CharT_ char-type
+ * @param src source characters
+ * @param dst destination, needs space for n characters, may be identical to src
+ * @param n number of characters
+ */
+template <LetterCase Case_, typename CharT_> void convertCase(CharT_ const *src, CharT_ *dst, std::size_t n)
+{
+    std::size_t i = 0UL;
+    if constexpr (sizeof(CharT_) == 1UL)
+    {
+        auto const *srcBytes = reinterpret_cast<unsigned char const *>(src);
+        auto       *dstBytes = reinterpret_cast<unsigned char *>(dst);
+        for (; i + SIMD_BLOCK_SIZE <= n; i += SIMD_BLOCK_SIZE)
+        {
+            if (!asciiCaseBlock<Case_>(srcBytes + i, dstBytes + i))
+            {
+                for (std::size_t j = i; j < i + SIMD_BLOCK_SIZE; ++j)
+                {
+                    dst[j] = isAsciiChar(src[j]) ? asciiCaseChar<Case_>(src[j]) : wideCaseChar<Case_>(src[j]);
+                }
+            }
+        }
+    }
+    for (; i < n; ++i)
+    {
+        dst[i] = isAsciiChar(src[i]) ? asciiCaseChar<Case_>(src[i]) : wideCaseChar<Case_>(src[i]);
+    }
+}
+
+/**
+ * @brief Case-convert n characters from src and write them to an output iterator.
+ *        Raw pointers are written directly, any other iterator receives the result through a small
+ *        stack buffer, so no heap allocation takes place.
+ *
+ * @tparam Case_ target case
+ * @tparam CharT_ char-type
+ * @tparam OutputIt_ output iterator accepting CharT_
+ * @param src source characters
+ * @param n number of characters
+ * @param out destination iterator
+ * @return OutputIt_ iterator past the last written character
+ */
+template <LetterCase Case_, typename CharT_, typename OutputIt_>
+OutputIt_ convertCaseTo(CharT_ const *src, std::size_t n, OutputIt_ out)
+{
+    if constexpr (std::is_same_v<OutputIt_, CharT_ *>)
+    {
+        convertCase<Case_>(src, out, n);
+        return out + n;
+    }
+    else
+    {
+        constexpr std::size_t chunkSize = 16UL * SIMD_BLOCK_SIZE;
+        CharT_                chunk[chunkSize];
+        for (std::size_t i = 0UL; i < n; i += chunkSize)
+        {
+            std::size_t const len = n - i < chunkSize ? n - i : chunkSize;
+            convertCase<Case_>(src + i, chunk, len);
+            for (std::size_t j = 0UL; j < len; ++j)
+            {
+                *out = chunk[j];
+                ++out;
+            }
+        }
+        return out;
+    }
+}
+/**
+ * @brief Bitmask of the occurrences of a byte in one block of SIMD_BLOCK_SIZE bytes.
+ *
+ * @param src the block
+ * @param b the byte to look for
+ * @return uint64_t mask in which bit i is set iff src[i] == b
+ */
+inline uint64_t byteMatchMask(unsigned char const *src, unsigned char b)
+{
+#if defined(__AVX2__)
+    __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(b)))));
+#elif defined(__SSE2__)
+    __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(b)))));
+#else
+    uint64_t word = 0ULL;
+    std::memcpy(&word, src, sizeof(word));
+    word ^= broadcastByte(b);
+    // exact zero-byte detection (no false positives from borrows): bit 7 of a byte is set iff the byte is zero
+    uint64_t const zero = ~(((word & broadcastByte(0x7F)) + broadcastByte(0x7F)) | word) & broadcastByte(0x80);
+    // gather bit 7 of byte k into bit 56 + k, the partial products never overlap, so nothing carries
+    return ((zero >> 7U) * 0x01020408'10204080ULL) >> 56U;
+#endif
+}
+
+/**
+ * @brief Call onMatch(i) for every position i with src[i] == b, in ascending order.
+ *        The positions are found 64 bytes at a time as a bitmask, so the cost per match is a count-trailing-zeros
+ *        rather than a new search.
+ *
+ * @tparam Func_ callable taking a std::size_t
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param b the byte to look for
+ * @param onMatch callback receiving the positions
+ */
+template <typename Func_> void forEachByteOf(unsigned char const *src, std::size_t n, unsigned char b, Func_ &&onMatch)
+{
+    constexpr std::size_t blocksPer64 = 64UL / SIMD_BLOCK_SIZE;
+
+    std::size_t i = 0UL;
+    for (; i + 64UL <= n; i += 64UL)
+    {
+        uint64_t mask = 0ULL;
+        for (std::size_t block = 0UL; block < blocksPer64; ++block)
+        {
+            mask |= byteMatchMask(src + i + block * SIMD_BLOCK_SIZE, b) << (block * SIMD_BLOCK_SIZE);
+        }
+        for (; mask != 0ULL; mask &= mask - 1ULL)
+        {
+            onMatch(i + static_cast<std::size_t>(std::countr_zero(mask)));
+        }
+    }
+    for (; i + SIMD_BLOCK_SIZE <= n; i += SIMD_BLOCK_SIZE)
+    {
+        for (uint64_t mask = byteMatchMask(src + i, b); mask != 0ULL; mask &= mask - 1ULL)
+        {
+            onMatch(i + static_cast<std::size_t>(std::countr_zero(mask)));
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if (src[i] == b)
+        {
+            onMatch(i);
+        }
+    }
+}
+
+/**
+ * @brief Incremental search for the occurrences of a byte, one SIMD block at a time.
+ *        The occurrences of the current block are kept as a bitmask, so that consecutive calls of next() usually
+ *        cost a count-trailing-zeros rather than a new search; the scan never runs more than one block ahead of
+ *        the returned position.
+ */
+class ByteScanner
+{
+  public:
+    /**
+     * @brief Find the next occurrence of b after the one previously returned.
+     *
+     * @param src the bytes to search, must be the same for all calls
+     * @param n number of bytes, must be the same for all calls
+     * @param b the byte to look for, must be the same for all calls
+     * @return std::size_t position of the next b, or n if there is none
+     */
+    std::size_t next(unsigned char const *src, std::size_t n, unsigned char b)
+    {
+        while (mask_ == 0ULL)
+        {
+            if (scanned_ >= n)
+            {
+                return n;
+            }
+            base_ = scanned_;
+            if (scanned_ + SIMD_BLOCK_SIZE <= n)
+            {
+                mask_ = byteMatchMask(src + scanned_, b);
+                scanned_ += SIMD_BLOCK_SIZE;
+            }
+            else
+            {
+                for (; scanned_ < n; ++scanned_)
+                {
+                    mask_ |= src[scanned_] == b ? 1ULL << (scanned_ - base_) : 0ULL;
+                }
+            }
+        }
+        auto const pos = base_ + static_cast<std::size_t>(std::countr_zero(mask_));
+        mask_ &= mask_ - 1ULL;
+
+        return pos;
+    }
+
+  private:
+    uint64_t    mask_    = 0ULL; ///< occurrences not yet returned, bit i stands for position base_ + i
+    std::size_t base_    = 0UL;
+    std::size_t scanned_ = 0UL; ///< all positions below scanned_ have been searched
+};
+
+/**
+ * @brief Count the occurrences of a byte.
+ *
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param b the byte to count
+ * @return std::size_t number of positions i with src[i] == b
+ */
+inline std::size_t countByteOf(unsigned char const *src, std::size_t n, unsigned char b)
+{
+    std::size_t count = 0UL;
+    std::size_t i     = 0UL;
+    for (; i + SIMD_BLOCK_SIZE <= n; i += SIMD_BLOCK_SIZE)
+    {
+        count += static_cast<std::size_t>(std::popcount(byteMatchMask(src + i, b)));
+    }
+    for (; i < n; ++i)
+    {
+        count += src[i] == b ? 1UL : 0UL;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Bitmask of the bytes in one block of SIMD_BLOCK_SIZE bytes that are not decimal digits.
+ *
+ * @param src the block
+ * @return uint64_t mask in which bit i is set iff src[i] is not in ['0', '9']
+ */
+inline uint64_t nonDigitMask(unsigned char const *src)
+{
+#if defined(__AVX2__)
+    __m256i const offset =
+        _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(src)), _mm256_set1_epi8('0'));
+    // a byte is a digit iff its offset from '0' is at most 9, unsigned
+    __m256i const isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(9)), offset);
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(isDigit));
+#elif defined(__SSE2__)
+    __m128i const offset = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src)), _mm_set1_epi8('0'));
+    // a byte is a digit iff its offset from '0' is at most 9, unsigned
+    __m128i const isDigit = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(9)), offset);
+    return ~static_cast<uint32_t>(_mm_movemask_epi8(isDigit)) & 0xFFFFU;
+#else
+    uint64_t word = 0ULL;
+    std::memcpy(&word, src, sizeof(word));
+    // a byte is a digit iff its high nibble is 3 and adding 6 to its low nibble does not carry into bit 4
+    uint64_t const wrong = ((word & broadcastByte(0xF0)) ^ broadcastByte(0x30))
+                           | (((word & broadcastByte(0x0F)) + broadcastByte(0x06)) & broadcastByte(0x10));
+    // exact non-zero-byte detection: bit 7 of a byte is set iff the byte is non-zero
+    uint64_t const nonZero = (((wrong & broadcastByte(0x7F)) + broadcastByte(0x7F)) | wrong) & broadcastByte(0x80);
+    // gather bit 7 of byte k into bit 56 + k, as in byteMatchMask
+    return ((nonZero >> 7U) * 0x01020408'10204080ULL) >> 56U;
+#endif
+}
+
+/**
+ * @brief Length of the run of decimal digits at the start of n bytes, a SIMD block at a time.
+ *
+ * @param src the bytes
+ * @param n number of bytes
+ * @return std::size_t number of leading bytes in ['0', '9']
+ */
+inline std::size_t digitRunLength(unsigned char const *src, std::size_t n)
+{
+    std::size_t i = 0UL;
+    for (; i + SIMD_BLOCK_SIZE <= n; i += SIMD_BLOCK_SIZE)
+    {
+        if (auto const mask = nonDigitMask(src + i); mask != 0ULL)
+        {
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    while (i < n && src[i] >= '0' && src[i] <= '9')
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Membership bitmap over all 256 byte values.
+ */
+class ByteSet
+{
+  public:
+    /**
+     * @brief Add a byte value to the set.
+     *
+     * @param b the byte value
+     */
+    constexpr void insert(uint8_t b)
+    {
+        bits_[b >> 6U] |= 1ULL << (b & 63U);
+    }
+
+    /**
+     * @brief Check whether a byte value is in the set.
+     *
+     * @param b the byte value
+     * @return true, if b is in the set, false otherwise
+     */
+    [[nodiscard]] constexpr bool contains(uint8_t b) const
+    {
+        return (bits_[b >> 6U] & (1ULL << (b & 63U))) != 0ULL;
+    }
+
+    /**
+     * @brief Number of byte values in the set.
+     *
+     * @return std::size_t the count
+     */
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        std::size_t reval = 0UL;
+        for (auto word: bits_)
+        {
+            reval += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        return reval;
+    }
+
+    /**
+     * @brief Call a function for every byte value in the set, in ascending order.
+     *
+     * @tparam Func_ callable taking an uint8_t
+     * @param func the function to call
+     */
+    template <typename Func_> constexpr void forEach(Func_ &&func) const
+    {
+        for (std::size_t w = 0UL; w < std::size(bits_); ++w)
+        {
+            for (uint64_t word = bits_[w]; word != 0ULL; word &= word - 1ULL)
+            {
+                func(static_cast<uint8_t>(w * 64UL + static_cast<std::size_t>(std::countr_zero(word))));
+            }
+        }
+    }
+
+  private:
+    std::array<uint64_t, 4> bits_{};
+};
+
+/**
+ * @brief Compress-table for 8 lanes: entry m lists the positions of the set bits of m, in ascending order.
+ */
+inline constexpr auto COMPRESS_INDICES_8 = [] {
+    std::array<std::array<uint8_t, 8>, 256> table{};
+    for (std::size_t mask = 0UL; mask < 256UL; ++mask)
+    {
+        std::size_t out = 0UL;
+        for (uint8_t lane = 0U; lane < 8U; ++lane)
+        {
+            if ((mask & (1UL << lane)) != 0UL)
+            {
+                table[mask][out++] = lane;
+            }
+        }
+    }
+
+    return table;
+}();
+
+/**
+ * @brief Vectorised matcher of a ByteSet: classifies a whole SIMD block against the set at once.
+ *        With SSSE3 (and AVX2) any set is matched with two nibble-indexed shuffle lookups; plain SSE2 compares
+ *        against every member of sets of up to MAX_LISTED members. Otherwise matching falls back to the bitmap.
+ */
+class ByteSetMatcher
+{
+  public:
+    static constexpr std::size_t MAX_LISTED = 16UL;
+
+    /**
+     * @brief Construct the matcher from a byte set.
+     *
+     * @param set the set to match against
+     */
+    explicit ByteSetMatcher(ByteSet const &set)
+        : set_(set)
+    {
+        set.forEach([this](uint8_t b) {
+            if (b < 0x80U)
+            {
+                nibbleLow_[b & 0x0FU] |= static_cast<uint8_t>(1U << (b >> 4U));
+            }
+            else
+            {
+                nibbleHigh_[b & 0x0FU] |= static_cast<uint8_t>(1U << ((b >> 4U) - 8U));
+            }
+            if (listed_ < MAX_LISTED)
+            {
+                list_[listed_] = b;
+            }
+            listed_++;
+        });
+    }
+
+    /**
+     * @brief Check whether matchBlock can be used on this platform for this set.
+     *
+     * @return true, if blocks can be matched with SIMD, false otherwise
+     */
+    [[nodiscard]] bool vectorised() const
+    {
+#if defined(__SSSE3__)
+        return true;
+#elif defined(__SSE2__)
+        return listed_ <= MAX_LISTED;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Scalar membership test.
+     *
+     * @param b byte value
+     * @return true, if b is in the set, false otherwise
+     */
+    [[nodiscard]] bool contains(uint8_t b) const
+    {
+        return set_.contains(b);
+    }
+
+#if defined(__SSE2__)
+    /**
+     * @brief Match 16 bytes against the set.
+     *
+     * @param v the bytes
+     * @return uint32_t bit i is set iff byte i is in the set
+     */
+    [[nodiscard]] uint32_t match16(__m128i v) const
+    {
+    #if defined(__SSSE3__)
+        __m128i const lowNibbles  = _mm_and_si128(v, _mm_set1_epi8(0x0F));
+        __m128i const highNibbles = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+        __m128i const rowLow      = _mm_shuffle_epi8(loadTable(nibbleLow_), lowNibbles);
+        __m128i const rowHigh     = _mm_shuffle_epi8(loadTable(nibbleHigh_), lowNibbles);
+        __m128i const isHigh      = _mm_cmpgt_epi8(highNibbles, _mm_set1_epi8(7));
+        __m128i const row         = _mm_or_si128(_mm_and_si128(isHigh, rowHigh), _mm_andnot_si128(isHigh, rowLow));
+        __m128i const bit =
+            _mm_shuffle_epi8(_mm_set1_epi64x(static_cast<int64_t>(0x80402010'08040201ULL)), highNibbles);
+        __m128i const hit = _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+        return static_cast<uint32_t>(_mm_movemask_epi8(hit));
+    #else
+        __m128i hit = _mm_setzero_si128();
+        for (std::size_t i = 0UL; i < listed_; ++i)
+        {
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(list_[i]))));
+        }
+        return static_cast<uint32_t>(_mm_movemask_epi8(hit));
+    #endif
+    }
+#endif
+
+  private:
+#if defined(__SSSE3__)
+    static __m128i loadTable(std::array<uint8_t, 16> const &table)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+    }
+#endif
+
+    ByteSet                 set_;
+    std::array<uint8_t, 16> nibbleLow_{};  ///< bit h of entry l is set iff byte (h << 4 | l) is in the set, h < 8
+    std::array<uint8_t, 16> nibbleHigh_{}; ///< bit h - 8 of entry l is set iff byte (h << 4 | l) is in the set, h >= 8
+    std::array<uint8_t, MAX_LISTED> list_{};
+    std::size_t                     listed_ = 0UL;
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief Store the bytes of v whose bit is set in keep contiguously at dst.
+ *        Up to 16 bytes starting at dst may be written, but only the returned number of them is meaningful.
+ *
+ * @param v 16 bytes
+ * @param keep bit i is set iff byte i is to be kept
+ * @param dst destination
+ * @return std::size_t number of bytes kept
+ */
+inline std::size_t compressStore16(__m128i v, uint32_t keep, unsigned char *dst)
+{
+    auto const keepLow  = keep & 0xFFU;
+    auto const keepHigh = (keep >> 8U) & 0xFFU;
+    auto const numLow   = static_cast<std::size_t>(std::popcount(keepLow));
+    #if defined(__SSSE3__)
+    __m128i const indexLow  = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(COMPRESS_INDICES_8[keepLow].data()));
+    __m128i const indexHigh = _mm_add_epi8(
+        _mm_loadl_epi64(reinterpret_cast<__m128i const *>(COMPRESS_INDICES_8[keepHigh].data())),
+        _mm_set1_epi8(8)
+    );
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(v, indexLow));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + numLow), _mm_shuffle_epi8(v, indexHigh));
+    #else
+    alignas(16) unsigned char bytes[16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(bytes), v);
+    std::size_t out = 0UL;
+    for (uint32_t k = keep & 0xFFFFU; k != 0U; k &= k - 1U)
+    {
+        dst[out++] = bytes[std::countr_zero(k)];
+    }
+    #endif
+    return numLow + static_cast<std::size_t>(std::popcount(keepHigh));
+}
+#endif
+
+/**
+ * @brief Copy n bytes from src to dst, dropping every byte that is in the matcher's set.
+ *        dst may alias src as long as dst <= src, which makes this an in-place compaction.
+ *
+ * @param src source bytes
+ * @param n number of source bytes
+ * @param dst destination, dst <= src or non-overlapping
+ * @param matcher the set of bytes to drop
+ * @return std::size_t number of bytes written to dst
+ */
+inline std::size_t
+    compactBytes(unsigned char const *src, std::size_t n, unsigned char *dst, ByteSetMatcher const &matcher)
+{
+    std::size_t i = 0UL;
+    std::size_t w = 0UL;
+#if defined(__SSE2__)
+    if (matcher.vectorised())
+    {
+        for (; i + 16UL <= n; i += 16UL)
+        {
+            // the whole block is in a register before anything is stored, so overlapping dst <= src is safe
+            __m128i const  v    = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            uint32_t const drop = matcher.match16(v);
+            if (drop == 0U)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + w), v);
+                w += 16UL;
+            }
+            else if (drop != 0xFFFFU)
+            {
+                w += compressStore16(v, ~drop & 0xFFFFU, dst + w);
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        if (!matcher.contains(src[i]))
+        {
+            dst[w++] = src[i];
+        }
+    }
+
+    return w;
+}
+
+/**
+ * @brief Call onMatch(i) for every position i with src[i] in the matcher's set, in ascending order.
+ *        Like forEachByteOf, the positions of 64 bytes at a time are collected in one bitmask.
+ *
+ * @tparam Func_ callable taking a std::size_t
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param matcher the set of bytes to look for
+ * @param onMatch callback receiving the positions
+ */
+template <typename Func_>
+void forEachByteInSet(unsigned char const *src, std::size_t n, ByteSetMatcher const &matcher, Func_ &&onMatch)
+{
+    std::size_t i = 0UL;
+#if defined(__SSE2__)
+    if (matcher.vectorised())
+    {
+        for (; i + 64UL <= n; i += 64UL)
+        {
+            uint64_t mask = 0ULL;
+            for (std::size_t block = 0UL; block < 4UL; ++block)
+            {
+                __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + block * 16UL));
+                mask |= static_cast<uint64_t>(matcher.match16(v)) << (block * 16UL);
+            }
+            for (; mask != 0ULL; mask &= mask - 1ULL)
+            {
+                onMatch(i + static_cast<std::size_t>(std::countr_zero(mask)));
+            }
+        }
+        for (; i + 16UL <= n; i += 16UL)
+        {
+            auto mask = matcher.match16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)));
+            for (; mask != 0U; mask &= mask - 1U)
+            {
+                onMatch(i + static_cast<std::size_t>(std::countr_zero(mask)));
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        if (matcher.contains(src[i]))
+        {
+            onMatch(i);
+        }
+    }
+}
+
+/**
+ * @brief Find the first position i with src[i] in the matcher's set.
+ *
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param matcher the set of bytes to look for
+ * @return std::size_t the position, or n if there is none
+ */
+inline std::size_t findFirstByteInSet(unsigned char const *src, std::size_t n, ByteSetMatcher const &matcher)
+{
+    std::size_t i = 0UL;
+#if defined(__SSE2__)
+    if (matcher.vectorised())
+    {
+        for (; i + 16UL <= n; i += 16UL)
+        {
+            if (auto const mask = matcher.match16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)));
+                mask != 0U)
+            {
+                return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        if (matcher.contains(src[i]))
+        {
+            return i;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief Compare a few bytes. For the short ranges verified by findBytes, an inlined loop is cheaper than a call to
+ *        memcmp.
+ *
+ * @param lhs the first range of bytes
+ * @param rhs the second range of bytes
+ * @param n number of bytes
+ * @return true if both ranges hold the same bytes, false otherwise
+ */
+inline bool bytesEqual(unsigned char const *lhs, unsigned char const *rhs, std::size_t n)
+{
+    for (std::size_t i = 0UL; i < n; ++i)
+    {
+        if (lhs[i] != rhs[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Find the first occurrence of a needle of at least two bytes.
+ *        Every SIMD block of candidate positions is filtered at once by comparing it with the first byte of the
+ *        needle, and the block m - 1 bytes further with its last byte; only positions passing both compares are
+ *        verified byte by byte, which for most texts leaves very few of them.
+ *
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param needle the bytes to look for
+ * @param m length of the needle, at least 2
+ * @return std::size_t position of the first occurrence, or n if there is none
+ */
+inline std::size_t findBytes(unsigned char const *src, std::size_t n, unsigned char const *needle, std::size_t m)
+{
+    if (m > n)
+    {
+        return n;
+    }
+    auto const  last = n - m; // the last candidate position
+    std::size_t i    = 0UL;
+#if defined(__AVX2__)
+    __m256i const first32 = _mm256_set1_epi8(static_cast<char>(needle[0]));
+    __m256i const last32  = _mm256_set1_epi8(static_cast<char>(needle[m - 1UL]));
+    for (; i + 32UL <= last + 1UL; i += 32UL)
+    {
+        __m256i const atFirst = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        __m256i const atLast  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i + m - 1UL));
+        auto          mask    = static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(atFirst, first32), _mm256_cmpeq_epi8(atLast, last32))
+        ));
+        for (; mask != 0U; mask &= mask - 1U)
+        {
+            auto const pos = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (bytesEqual(src + pos + 1UL, needle + 1UL, m - 2UL))
+            {
+                return pos;
+            }
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const first16 = _mm_set1_epi8(static_cast<char>(needle[0]));
+    __m128i const last16  = _mm_set1_epi8(static_cast<char>(needle[m - 1UL]));
+    for (; i + 16UL <= last + 1UL; i += 16UL)
+    {
+        __m128i const atFirst = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        __m128i const atLast  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + m - 1UL));
+        auto          mask    = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(atFirst, first16), _mm_cmpeq_epi8(atLast, last16)))
+        );
+        for (; mask != 0U; mask &= mask - 1U)
+        {
+            auto const pos = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (bytesEqual(src + pos + 1UL, needle + 1UL, m - 2UL))
+            {
+                return pos;
+            }
+        }
+    }
+#endif
+    for (; i <= last; ++i)
+    {
+        auto const *found = static_cast<unsigned char const *>(std::memchr(src + i, needle[0], last + 1UL - i));
+        if (found == nullptr)
+        {
+            break;
+        }
+        i = static_cast<std::size_t>(found - src);
+        if (src[i + m - 1UL] == needle[m - 1UL] && bytesEqual(src + i + 1UL, needle + 1UL, m - 2UL))
+        {
+            return i;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief Filter for one byte of a needle compared ignoring the ASCII case: a haystack byte h is a candidate for the
+ *        needle byte iff (h | orMask) == target. For an ASCII letter, only its two cases pass; other ASCII bytes
+ *        (including non-letters like '@' and '`', that differ from a letter only in bit 0x20) compare exactly; and
+ *        non-ASCII needle bytes accept every non-ASCII byte, to be decided by the char-traits on verification.
+ */
+struct FoldedByteFilter
+{
+    /**
+     * @brief Construct the filter for a needle byte.
+     *
+     * @param b the needle byte
+     */
+    constexpr explicit FoldedByteFilter(unsigned char b)
+        : orMask(b >= 0x80U ? 0x7FU : (b | 0x20U) >= 'a' && (b | 0x20U) <= 'z' ? 0x20U : 0x00U)
+        , target(b >= 0x80U ? 0xFFU : b | orMask)
+    {
+    }
+
+    unsigned char orMask; ///< bits ignored by the comparison
+    unsigned char target; ///< the haystack byte with the orMask bits set must be equal to target
+
+    /**
+     * @brief Check whether a haystack byte passes the filter.
+     *
+     * @param h the haystack byte
+     * @return true if h is a candidate, false otherwise
+     */
+    [[nodiscard]] constexpr bool accepts(unsigned char h) const
+    {
+        return static_cast<unsigned char>(h | orMask) == target;
+    }
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief Lower-case the ASCII letters of a block of 16 bytes, leaving all other bytes unchanged.
+ *
+ * @param v the block
+ * @return __m128i the folded block
+ */
+inline __m128i asciiLowerBlock16(__m128i v)
+{
+    // non-ASCII bytes are negative as signed bytes, so they are never in range
+    __m128i const isUpper =
+        _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+    return _mm_or_si128(v, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+/**
+ * @brief Compare bytes ignoring the case of ASCII letters, deciding pairs involving a non-ASCII byte with eqNonAscii.
+ *        With SSE2, 16 bytes are folded and compared at once; eqNonAscii is only called where the folded blocks differ.
+ *
+ * @tparam EqNonAscii_ callable (unsigned char, unsigned char) -> bool
+ * @param lhs the first range of bytes
+ * @param rhs the second range of bytes
+ * @param n number of bytes
+ * @param eqNonAscii equality of two bytes, at least one of which is non-ASCII
+ * @return true if all bytes are equal ignoring their case, false otherwise
+ */
+template <typename EqNonAscii_>
+bool bytesEqualIgnoringAsciiCase(
+    unsigned char const *lhs,
+    unsigned char const *rhs,
+    std::size_t          n,
+    EqNonAscii_         &eqNonAscii
+)
+{
+    auto const differ = [&eqNonAscii](unsigned char l, unsigned char r) {
+        return ((l | r) & 0x80U) == 0U ? asciiCaseChar<LetterCase::LOWER>(l) != asciiCaseChar<LetterCase::LOWER>(r)
+                                       : !eqNonAscii(l, r);
+    };
+
+    std::size_t i = 0UL;
+#if defined(__SSE2__)
+    for (; i + 16UL <= n; i += 16UL)
+    {
+        __m128i const l = asciiLowerBlock16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(lhs + i)));
+        __m128i const r = asciiLowerBlock16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(rhs + i)));
+        for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(l, r))) ^ 0xFFFFU; mask != 0U;
+             mask &= mask - 1U)
+        {
+            auto const at = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (differ(lhs[at], rhs[at]))
+            {
+                return false;
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        if (differ(lhs[i], rhs[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Find the first occurrence of a needle ignoring the case of ASCII letters.
+ *        Works like findBytes, but the blocks of candidate positions are filtered with a FoldedByteFilter for the
+ *        first and for the last byte of the needle, and candidates are verified with bytesEqualIgnoringAsciiCase.
+ *        ASCII bytes are only ever equal to ASCII bytes; where the needle or the haystack has a non-ASCII byte,
+ *        eqNonAscii decides, so that f.e. util::ci_char_traits can apply the locale there.
+ *
+ * @tparam EqNonAscii_ callable (unsigned char, unsigned char) -> bool
+ * @param src the bytes to search
+ * @param n number of bytes
+ * @param needle the bytes to look for
+ * @param m length of the needle, at least 1
+ * @param eqNonAscii equality of two bytes, at least one of which is non-ASCII
+ * @return std::size_t position of the first occurrence, or n if there is none
+ */
+template <typename EqNonAscii_>
+std::size_t findBytesIgnoringAsciiCase(
+    unsigned char const *src,
+    std::size_t          n,
+    unsigned char const *needle,
+    std::size_t          m,
+    EqNonAscii_        &&eqNonAscii
+)
+{
+    if (m > n)
+    {
+        return n;
+    }
+    auto const             last = n - m; // the last candidate position
+    FoldedByteFilter const firstFilter{needle[0]};
+    FoldedByteFilter const lastFilter{needle[m - 1UL]};
+    std::size_t            i = 0UL;
+#if defined(__AVX2__)
+    __m256i const firstOr32     = _mm256_set1_epi8(static_cast<char>(firstFilter.orMask));
+    __m256i const firstTarget32 = _mm256_set1_epi8(static_cast<char>(firstFilter.target));
+    __m256i const lastOr32     = _mm256_set1_epi8(static_cast<char>(lastFilter.orMask));
+    __m256i const lastTarget32 = _mm256_set1_epi8(static_cast<char>(lastFilter.target));
+    for (; i + 32UL <= last + 1UL; i += 32UL)
+    {
+        __m256i const atFirst = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        __m256i const atLast = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i + m - 1UL));
+        auto          mask    = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_or_si256(atFirst, firstOr32), firstTarget32),
+            _mm256_cmpeq_epi8(_mm256_or_si256(atLast, lastOr32), lastTarget32)
+        )));
+        for (; mask != 0U; mask &= mask - 1U)
+        {
+            auto const pos = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (bytesEqualIgnoringAsciiCase(src + pos, needle, m, eqNonAscii))
+            {
+                return pos;
+            }
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    __m128i const firstOr16     = _mm_set1_epi8(static_cast<char>(firstFilter.orMask));
+    __m128i const firstTarget16 = _mm_set1_epi8(static_cast<char>(firstFilter.target));
+    __m128i const lastOr16     = _mm_set1_epi8(static_cast<char>(lastFilter.orMask));
+    __m128i const lastTarget16 = _mm_set1_epi8(static_cast<char>(lastFilter.target));
+    for (; i + 16UL <= last + 1UL; i += 16UL)
+    {
+        __m128i const atFirst = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        __m128i const atLast = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + m - 1UL));
+        auto          mask    = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(_mm_or_si128(atFirst, firstOr16), firstTarget16),
+            _mm_cmpeq_epi8(_mm_or_si128(atLast, lastOr16), lastTarget16)
+        )));
+        for (; mask != 0U; mask &= mask - 1U)
+        {
+            auto const pos = i + static_cast<std::size_t>(std::countr_zero(mask));
+            if (bytesEqualIgnoringAsciiCase(src + pos, needle, m, eqNonAscii))
+            {
+                return pos;
+            }
+        }
+    }
+#endif
+    for (; i <= last; ++i)
+    {
+        if (firstFilter.accepts(src[i]) && lastFilter.accepts(src[i + m - 1UL])
+            && bytesEqualIgnoringAsciiCase(src + i, needle, m, eqNonAscii))
+        {
+            return i;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief Vectorised byte-to-byte translation through a 256-entry table.
+ *        With SSSE3 (and AVX2) an ASCII-only table is applied with one nibble-indexed shuffle per row of 16 byte
+ *        values that contains a translated byte: the shuffle looks up the difference to add to the bytes of that
+ *        row, so a block costs a few instructions per such row, whatever the number of translated bytes.
+ *        Tables translating non-ASCII bytes, and platforms without SSSE3, use the table byte by byte.
+ */
+class ByteTranslator
+{
+  public:
+    /**
+     * @brief Construct the translator from a table.
+     *
+     * @param table entry b is the translation of byte b
+     */
+    explicit ByteTranslator(std::array<uint8_t, 256> const &table)
+        : table_(table)
+    {
+        for (std::size_t b = 0UL; b < std::size(table_); ++b)
+        {
+            if (table_[b] == b)
+            {
+                continue;
+            }
+            if (b < 0x80UL)
+            {
+                delta_[b >> 4U][b & 0x0FU] = static_cast<uint8_t>(table_[b] - b);
+                activeRows_ |= 1U << (b >> 4U);
+            }
+            else
+            {
+                asciiOnly_ = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether translate16 can be used on this platform for this table.
+     *
+     * @return true, if blocks can be translated with SIMD, false otherwise
+     */
+    [[nodiscard]] bool vectorised() const
+    {
+#if defined(__SSSE3__)
+        return asciiOnly_;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Scalar translation.
+     *
+     * @param b byte value
+     * @return uint8_t the translated byte value
+     */
+    [[nodiscard]] uint8_t translate(uint8_t b) const
+    {
+        return table_[b];
+    }
+
+#if defined(__SSSE3__)
+    /**
+     * @brief Translate 16 bytes.
+     *
+     * @param v the bytes
+     * @return __m128i the translated bytes
+     */
+    [[nodiscard]] __m128i translate16(__m128i v) const
+    {
+        // bytes >= 0x80 have a high nibble above 7 and a zero shuffle result, so they are never changed
+        __m128i const highNibbles = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+        __m128i       reval       = v;
+        for (auto rows = activeRows_; rows != 0U; rows &= rows - 1U)
+        {
+            auto const    row   = std::countr_zero(rows);
+            __m128i const inRow = _mm_cmpeq_epi8(highNibbles, _mm_set1_epi8(static_cast<char>(row)));
+            __m128i const delta =
+                _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(delta_[row].data())), v);
+            reval = _mm_add_epi8(reval, _mm_and_si128(inRow, delta));
+        }
+
+        return reval;
+    }
+#endif
+
+#if defined(__AVX2__)
+    /**
+     * @brief Translate 32 bytes.
+     *
+     * @param v the bytes
+     * @return __m256i the translated bytes
+     */
+    [[nodiscard]] __m256i translate32(__m256i v) const
+    {
+        __m256i const highNibbles = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+        __m256i       reval       = v;
+        for (auto rows = activeRows_; rows != 0U; rows &= rows - 1U)
+        {
+            auto const    row   = std::countr_zero(rows);
+            __m256i const inRow = _mm256_cmpeq_epi8(highNibbles, _mm256_set1_epi8(static_cast<char>(row)));
+            __m256i const delta = _mm256_shuffle_epi8(
+                _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(delta_[row].data()))),
+                v
+            );
+            reval = _mm256_add_epi8(reval, _mm256_and_si256(inRow, delta));
+        }
+
+        return reval;
+    }
+#endif
+
+  private:
+    std::array<uint8_t, 256>               table_;
+    std::array<std::array<uint8_t, 16>, 8> delta_{};        ///< entry [h][l] is table_[h << 4 | l] - (h << 4 | l)
+    uint32_t                               activeRows_ = 0U; ///< bit h is set iff row h has a non-zero delta
+    bool                                   asciiOnly_  = true;
+};
+
+/**
+ * @brief Translate n bytes from src to dst.
+ *        dst may be the same as src, which makes this an in-place translation.
+ *
+ * @param src source bytes
+ * @param n number of bytes
+ * @param dst destination, dst == src or non-overlapping
+ * @param translator the translation table
+ */
+inline void
+    translateBytes(unsigned char const *src, std::size_t n, unsigned char *dst, ByteTranslator const &translator)
+{
+    std::size_t i = 0UL;
+#if defined(__SSSE3__)
+    if (translator.vectorised())
+    {
+    #if defined(__AVX2__)
+        for (; i + 32UL <= n; i += 32UL)
+        {
+            __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), translator.translate32(v));
+        }
+    #endif
+        for (; i + 16UL <= n; i += 16UL)
+        {
+            __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), translator.translate16(v));
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        dst[i] = translator.translate(src[i]);
+    }
+}
+
+/**
+ * @brief Error flags of the UTF-8 validation by pairs of consecutive bytes (Keiser and Lemire, "Validating UTF-8 In
+ *        Less Than One Instruction Per Byte"). Every flag marks a class of invalid pairs, so that a pair is invalid
+ *        iff the flags looked up for the high and the low nibble of its first byte and the high nibble of its second
+ *        byte have a common bit.
+ */
+inline constexpr uint8_t UTF8_TOO_SHORT      = 1U << 0U; ///< lead byte followed by ASCII or another lead byte
+inline constexpr uint8_t UTF8_TOO_LONG       = 1U << 1U; ///< ASCII followed by a continuation byte
+inline constexpr uint8_t UTF8_OVERLONG_3     = 1U << 2U; ///< E0 followed by 80..9F
+inline constexpr uint8_t UTF8_TOO_LARGE      = 1U << 3U; ///< F4 followed by 90..BF, or F5..FF followed by 90..BF
+inline constexpr uint8_t UTF8_SURROGATE      = 1U << 4U; ///< ED followed by A0..BF
+inline constexpr uint8_t UTF8_OVERLONG_2     = 1U << 5U; ///< C0 or C1 followed by a continuation byte
+inline constexpr uint8_t UTF8_TOO_LARGE_1000 = 1U << 6U; ///< F5..FF followed by 80..8F
+inline constexpr uint8_t UTF8_OVERLONG_4     = 1U << 6U; ///< F0 followed by 80..8F
+inline constexpr uint8_t UTF8_TWO_CONTS      = 1U << 7U; ///< two continuation bytes, valid only after 3/4-byte leads
+inline constexpr uint8_t UTF8_CARRY          = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+/**
+ * @brief Error flags by the high nibble of the first byte of a pair.
+ */
+inline constexpr std::array<uint8_t, 16> UTF8_BYTE_1_HIGH = {
+    // 0_______: ASCII
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    // 10______: continuation
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    UTF8_TWO_CONTS,
+    // 1100____, 1101____: 2-byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    // 1110____: 3-byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    // 1111____: 4-byte lead
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+/**
+ * @brief Error flags by the low nibble of the first byte of a pair.
+ */
+inline constexpr std::array<uint8_t, 16> UTF8_BYTE_1_LOW = {
+    // ____0000, ____0001
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    // ____001_
+    UTF8_CARRY,
+    UTF8_CARRY,
+    // ____0100
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    // ____0101, ____011_, ____1___
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    // ____1101
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+/**
+ * @brief Error flags by the high nibble of the second byte of a pair.
+ */
+inline constexpr std::array<uint8_t, 16> UTF8_BYTE_2_HIGH = {
+    // ________ 0_______: ASCII
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    // ________ 1000____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    // ________ 1001____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    // ________ 101_____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    // ________ 11______: lead byte
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+};
+
+/**
+ * @brief Largest byte values at the end of a 32-byte block that do not start a sequence running past the block.
+ */
+inline constexpr auto UTF8_INCOMPLETE_LIMITS = [] {
+    std::array<uint8_t, 32> reval{};
+    reval.fill(0xFFU);
+    reval[29] = 0xF0U - 1U; // a 4-byte lead 3 bytes before the end
+    reval[30] = 0xE0U - 1U; // a 3-byte lead 2 bytes before the end
+    reval[31] = 0xC0U - 1U; // any lead as the last byte
+
+    return reval;
+}();
+
+/**
+ * @brief Vectorised UTF-8 validation of consecutive blocks with the lookup-table algorithm of Keiser and Lemire:
+ *        three nibble-indexed shuffles classify every pair of consecutive bytes, and two saturating subtractions
+ *        find the bytes that must be the third or fourth byte of a sequence. Pure-ASCII groups of blocks only check
+ *        that no sequence was left incomplete before them. Errors accumulate, so that they can be tested once for
+ *        several blocks. Needs SSSE3 (AVX2 checks 32 bytes at a time); without it, the class has no members and
+ *        UTF-8 is validated by decoding.
+ */
+class Utf8Checker
+{
+  public:
+#if defined(__AVX2__)
+    static constexpr std::size_t BLOCK_SIZE = 32UL;
+#else
+    static constexpr std::size_t BLOCK_SIZE = 16UL;
+#endif
+    static constexpr std::size_t GROUP_SIZE = 4UL * BLOCK_SIZE;
+
+#if defined(__AVX2__)
+    /**
+     * @brief Check the next block of BLOCK_SIZE bytes.
+     *
+     * @param src the bytes
+     */
+    void check(unsigned char const *src)
+    {
+        __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+        if (_mm256_movemask_epi8(input) == 0)
+        {
+            error_    = _mm256_or_si256(error_, incomplete_);
+            previous_ = input;
+        }
+        else
+        {
+            checkBytes(input);
+        }
+    }
+
+    /**
+     * @brief Check the next group of GROUP_SIZE bytes, skipping it at once if it is pure ASCII.
+     *
+     * @param src the bytes
+     */
+    void checkGroup(unsigned char const *src)
+    {
+        __m256i const input0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src));
+        __m256i const input1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + 32UL));
+        __m256i const input2 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + 64UL));
+        __m256i const input3 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + 96UL));
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(input0, input1), _mm256_or_si256(input2, input3)))
+            == 0)
+        {
+            error_    = _mm256_or_si256(error_, incomplete_);
+            previous_ = input3;
+        }
+        else
+        {
+            checkBytes(input0);
+            checkBytes(input1);
+            checkBytes(input2);
+            checkBytes(input3);
+        }
+    }
+
+    /**
+     * @brief Check whether an error was found in the bytes checked so far.
+     *
+     * @return true, if there was an error, false otherwise
+     */
+    [[nodiscard]] bool hasError() const
+    {
+        return _mm256_testz_si256(error_, error_) == 0;
+    }
+
+  private:
+    static __m256i loadTable(std::array<uint8_t, 16> const &table)
+    {
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data())));
+    }
+
+    void checkBytes(__m256i input)
+    {
+        // the bytes 1, 2 and 3 positions before every byte of the block, reaching into the previous block
+        __m256i const carried   = _mm256_permute2x128_si256(previous_, input, 0x21);
+        __m256i const prev1     = _mm256_alignr_epi8(input, carried, 15);
+        __m256i const prev2     = _mm256_alignr_epi8(input, carried, 14);
+        __m256i const prev3     = _mm256_alignr_epi8(input, carried, 13);
+        __m256i const nibble    = _mm256_set1_epi8(0x0F);
+        __m256i const byte1High =
+            _mm256_shuffle_epi8(loadTable(UTF8_BYTE_1_HIGH), _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+        __m256i const byte1Low  = _mm256_shuffle_epi8(loadTable(UTF8_BYTE_1_LOW), _mm256_and_si256(prev1, nibble));
+        __m256i const byte2High =
+            _mm256_shuffle_epi8(loadTable(UTF8_BYTE_2_HIGH), _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+        __m256i const special   = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+        // bit 7 is set where a 3- or 4-byte lead 2 or 3 bytes before requires a continuation, which is exactly
+        // where the pair flags report UTF8_TWO_CONTS
+        __m256i const mustContinue = _mm256_and_si256(
+            _mm256_or_si256(
+                _mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60)), _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70))
+            ),
+            _mm256_set1_epi8(static_cast<char>(0x80))
+        );
+        error_      = _mm256_or_si256(error_, _mm256_xor_si256(mustContinue, special));
+        incomplete_ = _mm256_subs_epu8(
+            input, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(UTF8_INCOMPLETE_LIMITS.data()))
+        );
+        previous_ = input;
+    }
+
+    __m256i previous_   = _mm256_setzero_si256();
+    __m256i incomplete_ = _mm256_setzero_si256(); ///< non-zero where the previous block ends inside a sequence
+    __m256i error_      = _mm256_setzero_si256();
+#elif defined(__SSSE3__)
+    /**
+     * @brief Check the next block of BLOCK_SIZE bytes.
+     *
+     * @param src the bytes
+     */
+    void check(unsigned char const *src)
+    {
+        __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            error_    = _mm_or_si128(error_, incomplete_);
+            previous_ = input;
+        }
+        else
+        {
+            checkBytes(input);
+        }
+    }
+
+    /**
+     * @brief Check the next group of GROUP_SIZE bytes, skipping it at once if it is pure ASCII.
+     *
+     * @param src the bytes
+     */
+    void checkGroup(unsigned char const *src)
+    {
+        __m128i const input0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+        __m128i const input1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + 16UL));
+        __m128i const input2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + 32UL));
+        __m128i const input3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + 48UL));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(input0, input1), _mm_or_si128(input2, input3))) == 0)
+        {
+            error_    = _mm_or_si128(error_, incomplete_);
+            previous_ = input3;
+        }
+        else
+        {
+            checkBytes(input0);
+            checkBytes(input1);
+            checkBytes(input2);
+            checkBytes(input3);
+        }
+    }
+
+    /**
+     * @brief Check whether an error was found in the bytes checked so far.
+     *
+     * @return true, if there was an error, false otherwise
+     */
+    [[nodiscard]] bool hasError() const
+    {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(error_, _mm_setzero_si128())) != 0xFFFF;
+    }
+
+  private:
+    static __m128i loadTable(std::array<uint8_t, 16> const &table)
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+    }
+
+    void checkBytes(__m128i input)
+    {
+        __m128i const prev1     = _mm_alignr_epi8(input, previous_, 15);
+        __m128i const prev2     = _mm_alignr_epi8(input, previous_, 14);
+        __m128i const prev3     = _mm_alignr_epi8(input, previous_, 13);
+        __m128i const nibble    = _mm_set1_epi8(0x0F);
+        __m128i const byte1High =
+            _mm_shuffle_epi8(loadTable(UTF8_BYTE_1_HIGH), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+        __m128i const byte1Low  = _mm_shuffle_epi8(loadTable(UTF8_BYTE_1_LOW), _mm_and_si128(prev1, nibble));
+        __m128i const byte2High =
+            _mm_shuffle_epi8(loadTable(UTF8_BYTE_2_HIGH), _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+        __m128i const special      = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+        __m128i const mustContinue = _mm_and_si128(
+            _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0x60)), _mm_subs_epu8(prev3, _mm_set1_epi8(0x70))),
+            _mm_set1_epi8(static_cast<char>(0x80))
+        );
+        error_      = _mm_or_si128(error_, _mm_xor_si128(mustContinue, special));
+        incomplete_ = _mm_subs_epu8(
+            input, _mm_loadu_si128(reinterpret_cast<__m128i const *>(UTF8_INCOMPLETE_LIMITS.data() + 16))
+        );
+        previous_ = input;
+    }
+
+    __m128i previous_   = _mm_setzero_si128();
+    __m128i incomplete_ = _mm_setzero_si128(); ///< non-zero where the previous block ends inside a sequence
+    __m128i error_      = _mm_setzero_si128();
+#endif
+};
+
+/**
+ * @brief Count the bytes with a value of at least b (unsigned).
+ *
+ * @param src the bytes
+ * @param n number of bytes
+ * @param b the smallest value counted
+ * @return std::size_t number of bytes >= b
+ */
+inline std::size_t countBytesAtLeast(unsigned char const *src, std::size_t n, unsigned char b)
+{
+    std::size_t count = 0UL;
+    std::size_t i     = 0UL;
+#if defined(__AVX2__)
+    __m256i const bound = _mm256_set1_epi8(static_cast<char>(b));
+    for (; i + 32UL <= n; i += 32UL)
+    {
+        __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        auto const    atLeast =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, bound), v)));
+        count += static_cast<std::size_t>(std::popcount(atLeast));
+    }
+#elif defined(__SSE2__)
+    __m128i const bound = _mm_set1_epi8(static_cast<char>(b));
+    for (; i + 16UL <= n; i += 16UL)
+    {
+        __m128i const v       = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        auto const    atLeast = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, bound), v)));
+        count += static_cast<std::size_t>(std::popcount(atLeast));
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        count += src[i] >= b ? 1UL : 0UL;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Length of the run of ASCII code units at the start of src, for code units of 1, 2 or 4 bytes.
+ *        Whole blocks are tested at once by masking all bits above the 7 ASCII bits of every code unit.
+ *
+ * @tparam CharT_ char-type
+ * @param src the code units
+ * @param n number of code units
+ * @return std::size_t number of leading ASCII code units
+ */
+template <typename CharT_> std::size_t asciiRunLength(CharT_ const *src, std::size_t n)
+{
+    static_assert(sizeof(CharT_) == 1UL || sizeof(CharT_) == 2UL || sizeof(CharT_) == 4UL);
+
+    std::size_t i = 0UL;
+#if defined(__AVX2__) || defined(__SSE2__)
+    // the bits of a code unit above the ASCII range, repeated over 32 bits
+    constexpr auto NON_ASCII_BITS = sizeof(CharT_) == 1UL   ? 0x80808080U
+                                    : sizeof(CharT_) == 2UL ? 0xFF80FF80U
+                                                            : 0xFFFFFF80U;
+#endif
+#if defined(__AVX2__)
+    __m256i const highBits = _mm256_set1_epi32(static_cast<int>(NON_ASCII_BITS));
+    for (; i + 32UL / sizeof(CharT_) <= n; i += 32UL / sizeof(CharT_))
+    {
+        __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        if (_mm256_testz_si256(v, highBits) == 0)
+        {
+            break;
+        }
+    }
+#elif defined(__SSE2__)
+    __m128i const highBits = _mm_set1_epi32(static_cast<int>(NON_ASCII_BITS));
+    for (; i + 16UL / sizeof(CharT_) <= n; i += 16UL / sizeof(CharT_))
+    {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, highBits), _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+    }
+#endif
+    while (i < n && isAsciiChar(src[i]))
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Copy the run of ASCII code units at the start of src into dst, converting them to code units of another
+ *        width. Blocks of 16 code units are checked to be ASCII, narrowed to bytes (packus/packs) and widened to the
+ *        width of ToCharT_ (unpack with zero), so both checking and converting take a few instructions per block.
+ *
+ * @tparam ToCharT_ target char-type of 1, 2 or 4 bytes
+ * @tparam FromCharT_ source char-type of 1, 2 or 4 bytes
+ * @param src the code units
+ * @param n number of code units
+ * @param dst destination, needs space for n code units
+ * @return std::size_t number of leading ASCII code units copied
+ */
+template <typename ToCharT_, typename FromCharT_>
+std::size_t copyAsciiRun(FromCharT_ const *src, std::size_t n, ToCharT_ *dst)
+{
+    static_assert(sizeof(FromCharT_) == 1UL || sizeof(FromCharT_) == 2UL || sizeof(FromCharT_) == 4UL);
+    static_assert(sizeof(ToCharT_) == 1UL || sizeof(ToCharT_) == 2UL || sizeof(ToCharT_) == 4UL);
+
+    std::size_t i = 0UL;
+#if defined(__SSE2__)
+    constexpr auto VECTORS        = sizeof(FromCharT_); // 16 code units take 1, 2 or 4 vectors
+    constexpr auto NON_ASCII_BITS = sizeof(FromCharT_) == 1UL   ? 0x80808080U
+                                    : sizeof(FromCharT_) == 2UL ? 0xFF80FF80U
+                                                                : 0xFFFFFF80U;
+    __m128i const  highBits       = _mm_set1_epi32(static_cast<int>(NON_ASCII_BITS));
+    __m128i const  zero           = _mm_setzero_si128();
+    for (; i + 16UL <= n; i += 16UL)
+    {
+        __m128i v[VECTORS];
+        __m128i nonAscii = zero;
+        for (std::size_t k = 0UL; k < VECTORS; ++k)
+        {
+            v[k]     = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i) + k);
+            nonAscii = _mm_or_si128(nonAscii, _mm_and_si128(v[k], highBits));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(nonAscii, zero)) != 0xFFFF)
+        {
+            break;
+        }
+
+        // narrow to 16 bytes, all code units are below 0x80 so no saturation happens
+        __m128i bytes = v[0];
+        if constexpr (sizeof(FromCharT_) == 2UL)
+        {
+            bytes = _mm_packus_epi16(v[0], v[1]);
+        }
+        else if constexpr (sizeof(FromCharT_) == 4UL)
+        {
+            bytes = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+        }
+
+        // widen to the target width
+        auto *const out = reinterpret_cast<__m128i *>(dst + i);
+        if constexpr (sizeof(ToCharT_) == 1UL)
+        {
+            _mm_storeu_si128(out, bytes);
+        }
+        else if constexpr (sizeof(ToCharT_) == 2UL)
+        {
+            _mm_storeu_si128(out, _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(bytes, zero));
+        }
+        else
+        {
+            __m128i const low  = _mm_unpacklo_epi8(bytes, zero);
+            __m128i const high = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+        }
+    }
+#endif
+    for (; i < n && isAsciiChar(src[i]); ++i)
+    {
+        dst[i] = static_cast<ToCharT_>(src[i]);
+    }
+
+    return i;
+}
+
+} // namespace util::detail
+
+#endif // NS_UTIL_SIMD_KERNELS_H_INCLUDED
@@ -0,0 +1,390 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/stream_split.h
+ * Description: split input streams and file descriptors incrementally, with bounded memory
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_STREAM_SPLIT_H_INCLUDED
+#define NS_UTIL_STREAM_SPLIT_H_INCLUDED
+
+#include "stringutil.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+
+namespace util
+{
+/**
+ * @brief Validation of the input of a StreamSplitter, applied to every chunk as it is read.
+ */
+enum class InputValidation : int8_t
+{
+    NONE, ///< The input is split as it is
+    UTF8  ///< The input must be valid UTF-8, otherwise std::invalid_argument is thrown
+};
+
+/**
+ * @brief Incremental splitter over a source of characters that does not need to fit into memory, like an input
+ *        stream or a file descriptor.
+ *        The source is read in chunks of a fixed size into a buffer; tokens are views into that buffer and stay
+ *        valid until the next token is requested. Separators straddling two chunks are found, as the unconsumed
+ *        rest of a chunk is kept in front of the next one.
+ *        The tokens are those of splitIntoVector applied to the whole input: n separators yield n + 1 tokens.
+ *        Memory is bounded by the chunk size plus the longest token, however large the input is.
+ *        With InputValidation::UTF8, every chunk is validated with the vectorised UTF-8 check as it is read; a
+ *        character straddling two chunks is validated with the next one, so every token has been validated before it
+ *        is returned.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits, used to match the separator
+ */
+template <typename CharT_, typename TraitsT_ = std::char_traits<CharT_>> class StreamSplitter
+{
+  public:
+    using view_type = std::basic_string_view<CharT_, TraitsT_>;
+    using reader    = std::function<std::size_t(CharT_ *, std::size_t)>;
+
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64UL * 1'024UL;
+
+    /**
+     * @brief Input iterator over the tokens, the range ends at std::default_sentinel.
+     */
+    class iterator
+    {
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type       = view_type;
+        using difference_type  = std::ptrdiff_t;
+
+        iterator() = default;
+
+        view_type operator*() const
+        {
+            return *current_;
+        }
+
+        iterator &operator++()
+        {
+            current_ = parent_->next();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        friend bool operator==(iterator const &it, std::default_sentinel_t)
+        {
+            return !it.current_.has_value();
+        }
+
+      private:
+        friend class StreamSplitter;
+
+        explicit iterator(StreamSplitter *parent)
+            : parent_(parent)
+            , current_(parent->next())
+        {
+        }
+
+        StreamSplitter          *parent_ = nullptr;
+        std::optional<view_type> current_;
+    };
+
+    /**
+     * @brief Construct a splitter reading through a function.
+     *
+     * @param read function reading up to n characters into its buffer argument, returning 0 at the end of the input
+     * @param sep the separator, an empty separator yields the whole input as one token
+     * @param chunkSize number of characters read at a time
+     * @param validation validation of the input, InputValidation::UTF8 needs a byte-sized char-type
+     * @throw std::invalid_argument if UTF-8 validation is requested for a char-type that is not byte-sized
+     */
+    StreamSplitter(
+        reader                              read,
+        std::basic_string<CharT_, TraitsT_> sep,
+        std::size_t                         chunkSize  = DEFAULT_CHUNK_SIZE,
+        InputValidation                     validation = InputValidation::NONE
+    )
+        : read_(std::move(read))
+        , sep_(std::move(sep))
+        , chunkSize_(std::max(chunkSize, std::size(sep_) + 1UL))
+        , validation_(validation)
+    {
+        if (sizeof(CharT_) != 1UL && validation_ == InputValidation::UTF8)
+        {
+            throw std::invalid_argument("util::StreamSplitter: UTF-8 validation needs a byte-sized char-type");
+        }
+    }
+
+    /**
+     * @brief Read the next token.
+     *
+     * @return std::optional<view_type> the token, valid until the next call, or std::nullopt after the last token
+     * @throw std::invalid_argument if the input is validated and is not valid UTF-8
+     */
+    std::optional<view_type> next()
+    {
+        if (finished_)
+        {
+            return std::nullopt;
+        }
+        while (true)
+        {
+            auto const unread = view_type{std::data(buffer_) + begin_, end_ - begin_};
+            auto const found  = sep_.empty() ? view_type::npos : unread.find(sep_, scanFrom_ - begin_);
+            if (found != view_type::npos)
+            {
+                auto const token = unread.substr(0UL, found);
+                begin_ += found + std::size(sep_);
+                scanFrom_ = begin_;
+                return token;
+            }
+            if (eof_)
+            {
+                finished_ = true;
+                return unread;
+            }
+            // a separator may straddle the end of the buffer, so its first characters are searched again
+            auto const overlap = sep_.empty() ? 0UL : std::size(sep_) - 1UL;
+            scanFrom_          = std::max(begin_, end_ - std::min(end_, overlap));
+            refill();
+        }
+    }
+
+    /**
+     * @brief Iterator to the first token, reading it.
+     *
+     * @return iterator the begin-iterator
+     */
+    iterator begin()
+    {
+        return iterator{this};
+    }
+
+    /**
+     * @brief Sentinel marking the end of the tokens.
+     *
+     * @return std::default_sentinel_t the end
+     */
+    std::default_sentinel_t end() const
+    {
+        return std::default_sentinel;
+    }
+
+    /**
+     * @brief Current size of the buffer, which is bounded by the chunk size plus the longest token.
+     *
+     * @return std::size_t the number of characters the buffer holds
+     */
+    [[nodiscard]] std::size_t bufferSize() const
+    {
+        return std::size(buffer_);
+    }
+
+  private:
+    /**
+     * @brief Move the unconsumed characters to the front of the buffer and read the next chunk behind them.
+     */
+    void refill()
+    {
+        if (begin_ > 0UL)
+        {
+            std::copy(std::data(buffer_) + begin_, std::data(buffer_) + end_, std::data(buffer_));
+            scanFrom_ -= begin_;
+            validated_ = std::max(validated_, begin_) - begin_; // a separator may consume held back bytes
+            end_ -= begin_;
+            consumed_ += begin_;
+            begin_ = 0UL;
+        }
+        if (std::size(buffer_) < end_ + chunkSize_)
+        {
+            buffer_.resize(end_ + chunkSize_);
+        }
+        auto const count = read_(std::data(buffer_) + end_, chunkSize_);
+        eof_             = count == 0UL;
+        end_ += count;
+        if (validation_ == InputValidation::UTF8)
+        {
+            validateUtf8();
+        }
+    }
+
+    /**
+     * @brief Validate the characters read since the last validation, except a character that the next chunk may
+     *        complete.
+     *
+     * @throw std::invalid_argument if the characters are not valid UTF-8
+     */
+    void validateUtf8()
+    {
+        if constexpr (sizeof(CharT_) == 1UL)
+        {
+            auto const *const bytes  = reinterpret_cast<unsigned char const *>(std::data(buffer_)) + validated_;
+            auto const        unread = end_ - validated_;
+            auto const        count  = eof_ ? unread : detail::utf8CompletePrefixLength(bytes, unread);
+            auto const        valid  = detail::utf8ValidPrefixLength(bytes, count);
+            if (valid != count)
+            {
+                throw std::invalid_argument(
+                    "util::StreamSplitter: invalid UTF-8 at byte " + std::to_string(consumed_ + validated_ + valid)
+                );
+            }
+            validated_ += count;
+        }
+    }
+
+    reader                              read_;
+    std::basic_string<CharT_, TraitsT_> sep_;
+    std::size_t                         chunkSize_;
+    InputValidation                     validation_;
+    std::vector<CharT_>                 buffer_;
+    std::size_t                         begin_     = 0UL; ///< start of the unconsumed characters
+    std::size_t                         end_       = 0UL; ///< end of the characters read
+    std::size_t                         scanFrom_  = 0UL; ///< no separator starts in [begin_, scanFrom_)
+    std::size_t                         validated_ = 0UL; ///< end of the characters validated
+    std::size_t                         consumed_  = 0UL; ///< number of characters moved out of the buffer
+    bool                                eof_       = false;
+    bool                                finished_  = false;
+};
+
+namespace detail
+{
+/**
+ * @brief Copy a separator (character or string-like) into a string.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param sep the separator
+ * @return std::basic_string<CharT_, TraitsT_> the separator as a string
+ */
+template <typename CharT_, typename TraitsT_, typename SeparatorT_>
+std::basic_string<CharT_, TraitsT_> separatorString(SeparatorT_ const &sep)
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<SeparatorT_>, CharT_>)
+    {
+        return std::basic_string<CharT_, TraitsT_>(1UL, sep);
+    }
+    else
+    {
+        return std::basic_string<CharT_, TraitsT_>{asStringView<CharT_, TraitsT_>(sep)};
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Split an input stream incrementally.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param in the stream, must outlive the splitter
+ * @param sep the separator
+ * @param chunkSize number of characters read at a time
+ * @param validation validation of the input, InputValidation::UTF8 needs a byte-sized char-type
+ * @return StreamSplitter<CharT_, TraitsT_> input range of the tokens
+ * @throw std::system_error if reading from in fails (sets its badbit)
+ */
+template <typename CharT_, typename TraitsT_, typename SeparatorT_>
+StreamSplitter<CharT_, TraitsT_> streamSplit(
+    std::basic_istream<CharT_, TraitsT_> &in,
+    SeparatorT_ const                    &sep,
+    std::size_t                           chunkSize  = StreamSplitter<CharT_, TraitsT_>::DEFAULT_CHUNK_SIZE,
+    InputValidation                       validation = InputValidation::NONE
+)
+requires(detail::is_separator_for_v<SeparatorT_, CharT_>)
+{
+    auto read = [&in](CharT_ *buffer, std::size_t n) -> std::size_t {
+        in.read(buffer, static_cast<std::streamsize>(n));
+        if (in.bad())
+        {
+            // like fdSplit, a failing read is an error rather than the end of the input
+            throw std::system_error( // NOSONAR
+                std::make_error_code(std::io_errc::stream),
+                "util::streamSplit: read failed"
+            );
+        }
+        return static_cast<std::size_t>(in.gcount());
+    };
+
+    return StreamSplitter<CharT_, TraitsT_>{
+        read, detail::separatorString<CharT_, TraitsT_>(sep), chunkSize, validation
+    };
+}
+
+/**
+ * @brief Split the bytes read from a file descriptor (file, pipe, socket, ...) incrementally.
+ *
+ * @tparam SeparatorT_ separator type, needs to be either char or string-like
+ * @param fd the file descriptor, must stay open while the splitter is used
+ * @param sep the separator
+ * @param chunkSize number of bytes read at a time
+ * @param validation validation of the input
+ * @return StreamSplitter<char> input range of the tokens
+ * @throw std::system_error if reading from fd fails
+ */
+template <typename SeparatorT_>
+StreamSplitter<char> fdSplit(
+    int                fd,
+    SeparatorT_ const &sep,
+    std::size_t        chunkSize  = StreamSplitter<char>::DEFAULT_CHUNK_SIZE,
+    InputValidation    validation = InputValidation::NONE
+)
+requires(detail::is_separator_for_v<SeparatorT_, char>)
+{
+    auto read = [fd](char *buffer, std::size_t n) -> std::size_t {
+        while (true)
+        {
+            auto const count = ::read(fd, buffer, n);
+            if (count >= 0)
+            {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR)
+            {
+                throw std::system_error(errno, std::generic_category(), "util::fdSplit: read failed"); // NOSONAR
+            }
+        }
+    };
+
+    return StreamSplitter<char>{
+        read, detail::separatorString<char, std::char_traits<char>>(sep), chunkSize, validation
+    };
+}
+} // namespace util
+
+#endif // NS_UTIL_STREAM_SPLIT_H_INCLUDED
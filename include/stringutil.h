@@ -26,9 +26,19 @@
 #ifndef NS_UTIL_STRINGUTIL_H_INCLUDED
 #define NS_UTIL_STRINGUTIL_H_INCLUDED
 
+#include "char_set.h"
+#include "searcher.h"
+#include "simd_kernels.h"
 #include "to_string.h"
+#include "utf8.h"
+#include "view_hash_set.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <deque>
@@ -37,12 +47,22 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
 #include <set>
+#include <span>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace util
@@ -72,485 +92,2447 @@ enum class StripTrimMode : int8_t
     ALL     = FRONT | INSIDE | BACK ///< Strip or trim all occurrences in the string
 };
 
+/**
+ * @brief Treatment of consecutive delimiters when splitting by a set of delimiter characters.
+ */
+enum class DelimiterMode : int8_t
+{
+    EACH,         ///< Every delimiter separates two tokens, touching delimiters yield empty tokens
+    COLLAPSE_RUNS ///< A run of consecutive delimiters separates two tokens, as if it were a single delimiter
+};
+
 inline bool isModeSet(StripTrimMode mode, StripTrimMode bit)
 {
     return (std::byte(mode) & std::byte(bit)) == std::byte(bit);
 }
 
+namespace detail
+{
 /**
- * @brief Create an all-lower-case copy of the given string.
+ * @brief View the characters of a string-like object (std::basic_string, string_view, char-array or char-pointer)
+ *        with the traits of the string it is applied to.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @param str original string
- * @return StringT_ all-lower copy of the string
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits of the resulting view
+ * @tparam ConstStringT_ string-like type
+ * @param str the string-like object
+ * @return std::basic_string_view<CharT_, TraitsT_> view of the characters, empty for null-pointers
  */
-template <typename StringT_>
-inline StringT_ toLower(StringT_ str)
-requires(util::is_std_string_v<StringT_>)
+template <typename CharT_, typename TraitsT_, typename ConstStringT_>
+std::basic_string_view<CharT_, TraitsT_> asStringView(ConstStringT_ const &str)
 {
-    using char_type = util::is_std_string<StringT_>::char_type;
-    auto reval      = StringT_{};
-    for (auto c: str)
+    if constexpr (std::is_array_v<ConstStringT_>)
+    {
+        return std::basic_string_view<CharT_, TraitsT_>{str};
+    }
+    else if constexpr (std::is_pointer_v<ConstStringT_>)
     {
-        auto C = (static_cast<char_type>(towlower(static_cast<wchar_t>(c))));
-        reval += C;
+        return str == nullptr ? std::basic_string_view<CharT_, TraitsT_>{}
+                              : std::basic_string_view<CharT_, TraitsT_>{str};
     }
+    else
+    {
+        return std::basic_string_view<CharT_, TraitsT_>{std::data(str), std::size(str)};
+    }
+}
 
-    return reval;
+/**
+ * @brief The white-space characters used when an empty set of characters is given to strip.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ * @return std::basic_string_view<CharT_, TraitsT_> view of "\t \r\n"
+ */
+template <typename CharT_, typename TraitsT_> std::basic_string_view<CharT_, TraitsT_> defaultWhitespace()
+{
+    static constexpr CharT_ WHITESPACE[] = {CharT_('\t'), CharT_(' '), CharT_('\r'), CharT_('\n')};
+
+    return std::basic_string_view<CharT_, TraitsT_>{WHITESPACE, std::size(WHITESPACE)};
 }
 
 /**
- * @brief Create an all-upper-case copy of the given string.
+ * @brief Membership test for a set of characters that honours the char-traits, so that f.e. a case-insensitive
+ *        string matches both cases of a set-member.
+ *        Characters with a value below 256 are looked up in a bitmap. With std::char_traits the bitmap is filled
+ *        up-front from the members; with other traits every value is resolved through TraitsT_::find the first
+ *        time it is queried. Larger values are always resolved through TraitsT_::find.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @param str original string
- * @return std::basic_string<CharT_, TraitsT_> all-upper copy of the string
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
  */
-template <typename StringT_>
-inline StringT_ toUpper(StringT_ const &str)
-requires(util::is_std_string_v<StringT_>)
+template <typename CharT_, typename TraitsT_> class CharMembership
 {
-    using char_type = util::is_std_string<StringT_>::char_type;
-    auto reval      = StringT_{};
-    for (auto c: str)
+  public:
+    static constexpr bool EAGER = std::is_same_v<TraitsT_, std::char_traits<CharT_>>;
+
+    /**
+     * @brief Construct the membership test.
+     *
+     * @param members the characters in the set; the view must outlive this object
+     */
+    explicit CharMembership(std::basic_string_view<CharT_, TraitsT_> members)
+        : members_(members)
     {
-        auto C = (static_cast<char_type>(towupper(static_cast<wchar_t>(c))));
-        reval += C;
+        if constexpr (EAGER)
+        {
+            for (auto c: members_)
+            {
+                if (auto const index = indexOf(c); index < 256U)
+                {
+                    isMember_.insert(static_cast<uint8_t>(index));
+                }
+            }
+        }
     }
 
-    return reval;
+    /**
+     * @brief Check whether a character is in the set.
+     *
+     * @param c the character
+     * @return true, if c is in the set, false otherwise
+     */
+    bool contains(CharT_ c)
+    {
+        auto const index = indexOf(c);
+        if (index >= 256U)
+        {
+            return TraitsT_::find(std::data(members_), std::size(members_), c) != nullptr;
+        }
+        if constexpr (!EAGER)
+        {
+            if (!isResolved_.contains(static_cast<uint8_t>(index)))
+            {
+                isResolved_.insert(static_cast<uint8_t>(index));
+                if (TraitsT_::find(std::data(members_), std::size(members_), c) != nullptr)
+                {
+                    isMember_.insert(static_cast<uint8_t>(index));
+                }
+            }
+        }
+
+        return isMember_.contains(static_cast<uint8_t>(index));
+    }
+
+    /**
+     * @brief Resolve all values below 256 and return the resulting bitmap.
+     *
+     * @return detail::ByteSet const& bitmap of all members with a value below 256
+     */
+    detail::ByteSet const &bytes()
+    {
+        if constexpr (!EAGER)
+        {
+            for (unsigned index = 0U; index < 256U; ++index)
+            {
+                contains(static_cast<CharT_>(index));
+            }
+        }
+
+        return isMember_;
+    }
+
+  private:
+    static std::make_unsigned_t<CharT_> indexOf(CharT_ c)
+    {
+        return static_cast<std::make_unsigned_t<CharT_>>(c);
+    }
+
+    std::basic_string_view<CharT_, TraitsT_> members_;
+    detail::ByteSet                          isMember_;
+    detail::ByteSet                          isResolved_;
+};
+
+/**
+ * @brief Determine the range of characters that remains after stripping the front and/or back.
+ *
+ * @tparam CharT_ char-type
+ * @tparam MembershipT_ type providing bool contains(CharT_)
+ * @param data the characters
+ * @param len number of characters
+ * @param outside membership test for the characters to strip
+ * @param mode strip mode, only FRONT and BACK are considered
+ * @return std::pair<std::size_t, std::size_t> [start, finish) of the remaining characters
+ */
+template <typename CharT_, typename MembershipT_>
+std::pair<std::size_t, std::size_t>
+    keptRange(CharT_ const *data, std::size_t len, MembershipT_ &outside, StripTrimMode mode)
+{
+    std::size_t start  = 0UL;
+    std::size_t finish = len;
+    if (isModeSet(mode, StripTrimMode::FRONT))
+    {
+        while (start < finish && outside.contains(data[start]))
+        {
+            start++;
+        }
+    }
+    if (isModeSet(mode, StripTrimMode::BACK))
+    {
+        while (finish > start && outside.contains(data[finish - 1]))
+        {
+            finish--;
+        }
+    }
+
+    return {start, finish};
 }
 
 /**
- * @brief Strip left and/or right and/or interior of string.
+ * @brief Map std::basic_string and std::basic_string_view to the corresponding string-view type.
+ *
+ * @tparam T_ type to map
+ */
+template <typename T_> struct string_view_of
+{
+};
+
+template <typename CharT_, typename TraitsT_, typename AllocT_>
+struct string_view_of<std::basic_string<CharT_, TraitsT_, AllocT_>>
+{
+    using type = std::basic_string_view<CharT_, TraitsT_>;
+};
+
+template <typename CharT_, typename TraitsT_> struct string_view_of<std::basic_string_view<CharT_, TraitsT_>>
+{
+    using type = std::basic_string_view<CharT_, TraitsT_>;
+};
+
+template <typename T_> using string_view_of_t = typename string_view_of<std::remove_cvref_t<T_>>::type;
+
+/**
+ * @brief Check whether T_ is a std::basic_string or a std::basic_string_view.
+ */
+template <typename T_>
+inline constexpr bool is_string_or_view_v = requires { typename string_view_of_t<T_>; };
+
+/**
+ * @brief The std::pmr::basic_string with the char-type and traits of a std::basic_string or std::basic_string_view.
+ */
+template <typename T_>
+using pmr_string_of_t =
+    std::pmr::basic_string<typename string_view_of_t<T_>::value_type, typename string_view_of_t<T_>::traits_type>;
+
+/**
+ * @brief Strip characters in place: the kept range is erased from, or compacted towards, the front of the string,
+ *        so that no temporary string is needed.
+ *        Inside-stripping of byte-sized strings uses the SIMD compaction kernel once the range is long enough to
+ *        amortise setting up the vectorised matcher.
  *
  * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
- * @param str original string
- * @param stripChars characters to strip
+ * @tparam MembershipT_ type providing bool contains(char_type) and, for byte-sized chars, ByteSet bytes()
+ * @param str the string to strip
+ * @param outside membership test for the front and back
+ * @param inside membership test for the interior
  * @param mode strip mode
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-void strip(StringT_ &str, ConstStringT_ const &stripChars = ConstStringT_{0}, StripTrimMode mode = StripTrimMode::ALL)
+template <typename StringT_, typename MembershipT_>
+void stripInPlace(StringT_ &str, MembershipT_ &outside, MembershipT_ &inside, StripTrimMode mode)
 {
-    if (std::empty(str))
+    using char_type = typename StringT_::value_type;
+
+    auto const [start, finish] = keptRange(std::data(str), std::size(str), outside, mode);
+
+    if (!isModeSet(mode, StripTrimMode::INSIDE))
     {
+        str.erase(finish);
+        str.erase(0, start);
         return;
     }
-    bool     doStripFront  = isModeSet(mode, StripTrimMode::FRONT);
-    bool     doStripInside = isModeSet(mode, StripTrimMode::INSIDE);
-    bool     doStripBack   = isModeSet(mode, StripTrimMode::BACK);
-    StringT_ reval;
 
-    typename StringT_::size_type start  = doStripFront ? str.find_first_not_of(stripChars) : 0;
-    typename StringT_::size_type finish = doStripBack ? str.find_last_not_of(stripChars) + 1 : std::size(str);
+    constexpr std::size_t minVectorisedLength = MembershipT_::EAGER ? 4UL * 16UL : 4UL * 256UL;
+    char_type            *data                = std::data(str);
+    std::size_t           kept                = 0UL;
+    if constexpr (sizeof(char_type) == 1UL)
+    {
+        if (finish - start >= minVectorisedLength)
+        {
+            kept = compactBytes(
+                reinterpret_cast<unsigned char const *>(data + start),
+                finish - start,
+                reinterpret_cast<unsigned char *>(data),
+                ByteSetMatcher{inside.bytes()}
+            );
+            str.resize(kept);
+            return;
+        }
+    }
+    for (auto i = start; i < finish; i++)
+    {
+        if (!inside.contains(data[i]))
+        {
+            data[kept++] = data[i];
+        }
+    }
+    str.resize(kept);
+}
+
+/**
+ * @brief Replace the characters of a set with a replacement character in the regions selected by mode.
+ *        If all characters are in the set, all of them are replaced, regardless of the mode.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam MembershipT_ type providing bool contains(char_type)
+ * @tparam CharT_ char-type of the replacement
+ * @param str the string to modify
+ * @param membership membership test of the characters to replace
+ * @param replaceWith replacement char
+ * @param mode strip-mode selecting the regions
+ */
+template <typename StringT_, typename MembershipT_, typename CharT_>
+void replaceCharInPlace(StringT_ &str, MembershipT_ &membership, CharT_ replaceWith, StripTrimMode mode)
+{
+    using char_type = typename StringT_::value_type;
+    using enum StripTrimMode;
 
-    if (start == StringT_::npos)
+    auto const  replacement      = static_cast<char_type>(replaceWith);
+    auto const  len              = std::size(str);
+    std::size_t firstNonReplChar = 0UL;
+    while (firstNonReplChar < len && membership.contains(str[firstNonReplChar]))
+    {
+        firstNonReplChar++;
+    }
+    if (firstNonReplChar == len)
     {
-        str = "";
+        std::fill(std::begin(str), std::end(str), replacement);
         return;
     }
 
-    StringT_ stringStripChars{stripChars};
-    if (std::empty(stringStripChars))
+    std::size_t lastNonReplChar = len - 1UL;
+    while (membership.contains(str[lastNonReplChar]))
+    {
+        lastNonReplChar--;
+    }
+
+    if (isModeSet(mode, FRONT))
     {
-        stringStripChars = util::convert<StringT_>(std::string{"\t \r\n"});
+        std::fill(std::begin(str), std::begin(str) + firstNonReplChar, replacement);
+    }
+    if (isModeSet(mode, BACK))
+    {
+        std::fill(std::begin(str) + lastNonReplChar + 1, std::end(str), replacement);
+    }
+    if (isModeSet(mode, INSIDE))
+    {
+        for (auto i = firstNonReplChar + 1UL; i < lastNonReplChar; i++)
+        {
+            if (membership.contains(str[i]))
+            {
+                str[i] = replacement;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Character-to-character translation (like tr) that honours the char-traits, so that f.e. a case-insensitive
+ *        string translates both cases of a from-character.
+ *        The translations of all values below 256 are resolved up-front into a lookup table, larger values are
+ *        resolved through TraitsT_::eq. If a character occurs more than once in fromChars, its last occurrence
+ *        counts; if toChars is shorter than fromChars, its last character is repeated.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ */
+template <typename CharT_, typename TraitsT_> class CharTranslation
+{
+  public:
+    /**
+     * @brief Construct the translation.
+     *
+     * @param fromChars the characters to translate; the view must outlive this object
+     * @param toChars the translations, toChars[i] for fromChars[i]; the view must outlive this object
+     * @throw std::invalid_argument if fromChars is not empty, but toChars is
+     */
+    CharTranslation(
+        std::basic_string_view<CharT_, TraitsT_> fromChars,
+        std::basic_string_view<CharT_, TraitsT_> toChars
+    )
+        : from_(fromChars)
+        , to_(toChars)
+    {
+        if (std::empty(to_) && !std::empty(from_))
+        {
+            throw std::invalid_argument("util::translate: no characters to translate to"); // NOSONAR
+        }
+        for (std::size_t index = 0UL; index < std::size(table_); ++index)
+        {
+            table_[index] = static_cast<CharT_>(index);
+        }
+        if constexpr (std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+        {
+            for (std::size_t i = 0UL; i < std::size(from_); ++i)
+            {
+                if (auto const index = indexOf(from_[i]); index < 256U)
+                {
+                    table_[index] = target(i);
+                    isMember_.insert(static_cast<uint8_t>(index));
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t index = 0UL; index < std::size(table_); ++index)
+            {
+                if (auto const i = lastIndexOf(static_cast<CharT_>(index)); i.has_value())
+                {
+                    table_[index] = target(*i);
+                    isMember_.insert(static_cast<uint8_t>(index));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether a character is translated.
+     *
+     * @param c the character
+     * @return true, if c is one of the from-characters, false otherwise
+     */
+    [[nodiscard]] bool contains(CharT_ c) const
+    {
+        auto const index = indexOf(c);
+        return index < 256U ? isMember_.contains(static_cast<uint8_t>(index)) : lastIndexOf(c).has_value();
+    }
+
+    /**
+     * @brief Translate a character.
+     *
+     * @param c the character
+     * @return CharT_ the translation of c, c itself if it is not a from-character
+     */
+    [[nodiscard]] CharT_ translate(CharT_ c) const
+    {
+        auto const index = indexOf(c);
+        if (index < 256U)
+        {
+            return table_[index];
+        }
+        auto const i = lastIndexOf(c);
+
+        return i.has_value() ? target(*i) : c;
+    }
+
+    /**
+     * @brief The lookup table as bytes, for the vectorised translation of byte-sized characters.
+     *
+     * @return std::array<uint8_t, 256> entry b is the translation of b
+     */
+    [[nodiscard]] std::array<uint8_t, 256> bytes() const
+    requires(sizeof(CharT_) == 1UL)
+    {
+        return std::bit_cast<std::array<uint8_t, 256>>(table_);
+    }
+
+  private:
+    static std::make_unsigned_t<CharT_> indexOf(CharT_ c)
+    {
+        return static_cast<std::make_unsigned_t<CharT_>>(c);
+    }
+
+    [[nodiscard]] CharT_ target(std::size_t i) const
+    {
+        return to_[std::min(i, std::size(to_) - 1UL)];
     }
 
-    while (start < finish)
+    [[nodiscard]] std::optional<std::size_t> lastIndexOf(CharT_ c) const
     {
-        if (!doStripInside) // if we did not specify to strip inside-matches
+        for (auto i = std::size(from_); i > 0UL; --i)
+        {
+            if (TraitsT_::eq(from_[i - 1UL], c))
+            {
+                return i - 1UL;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::basic_string_view<CharT_, TraitsT_> from_;
+    std::basic_string_view<CharT_, TraitsT_> to_;
+    std::array<CharT_, 256>                  table_{};
+    detail::ByteSet                          isMember_;
+};
+
+/**
+ * @brief Translate characters in place in the regions selected by mode, the regions being those of
+ *        replaceCharInPlace: the leading and trailing runs of from-characters and everything between them.
+ *        If all characters are from-characters, all of them are translated, regardless of the mode.
+ *        Only the leading and trailing runs are scanned to find the regions; the selected regions are then
+ *        translated in one pass, vectorised for byte-sized characters once the range is long enough to amortise
+ *        setting up the kernel.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam TranslationT_ type providing bool contains(char_type), char_type translate(char_type) and, for byte-sized
+ *         chars, std::array<uint8_t, 256> bytes()
+ * @param str the string to modify
+ * @param translation the translation
+ * @param mode strip-mode selecting the regions
+ */
+template <typename StringT_, typename TranslationT_>
+void translateInPlace(StringT_ &str, TranslationT_ const &translation, StripTrimMode mode)
+{
+    using char_type = typename StringT_::value_type;
+    using enum StripTrimMode;
+
+    constexpr std::size_t minVectorisedLength = 4UL * 16UL;
+    char_type            *data                = std::data(str);
+    auto const            len                 = std::size(str);
+    auto const            translateRange      = [&translation, data](std::size_t begin, std::size_t end) {
+        if constexpr (sizeof(char_type) == 1UL)
         {
-            reval.append(&str[start], 1);
+            if (end - begin >= minVectorisedLength)
+            {
+                translateBytes(
+                    reinterpret_cast<unsigned char const *>(data + begin),
+                    end - begin,
+                    reinterpret_cast<unsigned char *>(data + begin),
+                    ByteTranslator{translation.bytes()}
+                );
+                return;
+            }
         }
-        else if (!stringStripChars.contains(str[start]))
+        for (auto i = begin; i < end; i++)
         {
-            reval.append(&str[start], 1);
+            data[i] = translation.translate(data[i]);
         }
+    };
+
+    if (mode == ALL)
+    {
+        translateRange(0UL, len);
+        return;
+    }
+    auto const [first, last] = keptRange(data, len, translation, OUTSIDE);
+    if (first == len)
+    {
+        translateRange(0UL, len);
+        return;
+    }
+    if (isModeSet(mode, INSIDE))
+    {
+        translateRange(isModeSet(mode, FRONT) ? 0UL : first, isModeSet(mode, BACK) ? len : last);
+        return;
+    }
+    if (isModeSet(mode, FRONT))
+    {
+        translateRange(0UL, first);
+    }
+    if (isModeSet(mode, BACK))
+    {
+        translateRange(last, len);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Convert the given string to all-lower-case in place, without allocating.
+ *        Pure-ASCII blocks are converted with SIMD, everything else character by character using towlower.
+ *        Strings of char8_t are UTF-8 and are converted like utf8ToLowerInPlace, which allocates once if the string
+ *        contains non-ASCII characters. Strings of char8_t with other char-traits (util::ci_u8string) are converted
+ *        code unit by code unit, like their traits compare them, so that equal strings have equal hashes.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the string to convert
+ */
+template <typename StringT_>
+inline void toLowerInPlace(StringT_ &str)
+requires(util::is_std_string_v<StringT_>)
+{
+    if constexpr (std::is_same_v<typename StringT_::traits_type, std::char_traits<char8_t>>)
+    {
+        detail::utf8ConvertCaseInPlace<detail::LetterCase::LOWER>(str);
+    }
+    else
+    {
+        detail::convertCase<detail::LetterCase::LOWER>(std::data(str), std::data(str), std::size(str));
+    }
+}
 
-        start++;
+/**
+ * @brief Convert the given string to all-upper-case in place, without allocating.
+ *        Pure-ASCII blocks are converted with SIMD, everything else character by character using towupper.
+ *        Strings of char8_t are UTF-8 and are converted like utf8ToUpperInPlace, which allocates once if the string
+ *        contains non-ASCII characters. Strings of char8_t with other char-traits (util::ci_u8string) are converted
+ *        code unit by code unit, like their traits compare them, so that equal strings have equal hashes.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the string to convert
+ */
+template <typename StringT_>
+inline void toUpperInPlace(StringT_ &str)
+requires(util::is_std_string_v<StringT_>)
+{
+    if constexpr (std::is_same_v<typename StringT_::traits_type, std::char_traits<char8_t>>)
+    {
+        detail::utf8ConvertCaseInPlace<detail::LetterCase::UPPER>(str);
+    }
+    else
+    {
+        detail::convertCase<detail::LetterCase::UPPER>(std::data(str), std::data(str), std::size(str));
     }
+}
+
+/**
+ * @brief Create an all-lower-case copy of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @return StringT_ all-lower copy of the string
+ */
+template <typename StringT_>
+inline StringT_ toLower(StringT_ const &str)
+requires(util::is_std_string_v<StringT_>)
+{
+    // copy with the allocator of str, so that strings using a memory resource keep using it
+    auto reval = StringT_{str, str.get_allocator()};
+    toLowerInPlace(reval);
+
+    return reval;
+}
+
+/**
+ * @brief Convert a temporary string to all-lower-case, re-using its buffer.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the temporary string
+ * @return StringT_ the converted string, holding the buffer of str
+ */
+template <typename StringT_>
+inline StringT_ toLower(StringT_ &&str)
+requires(util::is_std_string_v<StringT_> && !std::is_lvalue_reference_v<StringT_>)
+{
+    toLowerInPlace(str);
+
+    return std::move(str);
+}
+
+/**
+ * @brief Create an all-lower-case copy of a string or string-view, allocated from a memory resource.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str original string
+ * @param resource memory resource for the copy
+ * @return std::pmr::basic_string<CharT_, TraitsT_> all-lower copy of the string
+ */
+template <typename StringT_>
+inline detail::pmr_string_of_t<StringT_> toLower(StringT_ const &str, std::pmr::memory_resource *resource)
+requires(detail::is_string_or_view_v<StringT_>)
+{
+    auto reval = detail::pmr_string_of_t<StringT_>{detail::string_view_of_t<StringT_>{str}, resource};
+    toLowerInPlace(reval);
+
+    return reval;
+}
+
+/**
+ * @brief Write the all-lower-case version of a contiguous character range to an output iterator.
+ *
+ * @tparam RangeT_ contiguous range of characters, f.e. std::basic_string or std::basic_string_view
+ * @tparam OutputIt_ output iterator accepting the character type of RangeT_
+ * @param src the characters to convert
+ * @param out destination
+ * @return OutputIt_ iterator past the last written character
+ */
+template <typename RangeT_, typename OutputIt_>
+inline OutputIt_ toLower(RangeT_ const &src, OutputIt_ out)
+requires(
+    std::ranges::contiguous_range<RangeT_> && util::is_char_v<std::ranges::range_value_t<RangeT_>>
+    && std::output_iterator<OutputIt_, std::ranges::range_value_t<RangeT_>>
+)
+{
+    return detail::convertCaseTo<detail::LetterCase::LOWER>(std::ranges::data(src), std::ranges::size(src), out);
+}
+
+/**
+ * @brief Write the all-lower-case version of a contiguous character range into caller-owned storage.
+ *
+ * @tparam RangeT_ contiguous range of characters, f.e. std::basic_string or std::basic_string_view
+ * @tparam CharT_ char-type
+ * @tparam Extent_ extent of the destination span
+ * @param src the characters to convert
+ * @param dst destination storage
+ * @return std::size_t number of characters written, which is less than std::size(src) if dst is too small
+ */
+template <typename RangeT_, typename CharT_, std::size_t Extent_>
+inline std::size_t toLower(RangeT_ const &src, std::span<CharT_, Extent_> dst)
+requires(std::ranges::contiguous_range<RangeT_> && std::is_same_v<std::ranges::range_value_t<RangeT_>, CharT_>)
+{
+    auto const len = std::min(std::ranges::size(src), std::size(dst));
+    detail::convertCase<detail::LetterCase::LOWER>(std::ranges::data(src), std::data(dst), len);
+
+    return len;
+}
+
+/**
+ * @brief Create an all-upper-case copy of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @return std::basic_string<CharT_, TraitsT_> all-upper copy of the string
+ */
+template <typename StringT_>
+inline StringT_ toUpper(StringT_ const &str)
+requires(util::is_std_string_v<StringT_>)
+{
+    // copy with the allocator of str, so that strings using a memory resource keep using it
+    auto reval = StringT_{str, str.get_allocator()};
+    toUpperInPlace(reval);
+
+    return reval;
+}
+
+/**
+ * @brief Convert a temporary string to all-upper-case, re-using its buffer.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str the temporary string
+ * @return StringT_ the converted string, holding the buffer of str
+ */
+template <typename StringT_>
+inline StringT_ toUpper(StringT_ &&str)
+requires(util::is_std_string_v<StringT_> && !std::is_lvalue_reference_v<StringT_>)
+{
+    toUpperInPlace(str);
+
+    return std::move(str);
+}
+
+/**
+ * @brief Create an all-upper-case copy of a string or string-view, allocated from a memory resource.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str original string
+ * @param resource memory resource for the copy
+ * @return std::pmr::basic_string<CharT_, TraitsT_> all-upper copy of the string
+ */
+template <typename StringT_>
+inline detail::pmr_string_of_t<StringT_> toUpper(StringT_ const &str, std::pmr::memory_resource *resource)
+requires(detail::is_string_or_view_v<StringT_>)
+{
+    auto reval = detail::pmr_string_of_t<StringT_>{detail::string_view_of_t<StringT_>{str}, resource};
+    toUpperInPlace(reval);
+
+    return reval;
+}
+
+/**
+ * @brief Write the all-upper-case version of a contiguous character range to an output iterator.
+ *
+ * @tparam RangeT_ contiguous range of characters, f.e. std::basic_string or std::basic_string_view
+ * @tparam OutputIt_ output iterator accepting the character type of RangeT_
+ * @param src the characters to convert
+ * @param out destination
+ * @return OutputIt_ iterator past the last written character
+ */
+template <typename RangeT_, typename OutputIt_>
+inline OutputIt_ toUpper(RangeT_ const &src, OutputIt_ out)
+requires(
+    std::ranges::contiguous_range<RangeT_> && util::is_char_v<std::ranges::range_value_t<RangeT_>>
+    && std::output_iterator<OutputIt_, std::ranges::range_value_t<RangeT_>>
+)
+{
+    return detail::convertCaseTo<detail::LetterCase::UPPER>(std::ranges::data(src), std::ranges::size(src), out);
+}
+
+/**
+ * @brief Write the all-upper-case version of a contiguous character range into caller-owned storage.
+ *
+ * @tparam RangeT_ contiguous range of characters, f.e. std::basic_string or std::basic_string_view
+ * @tparam CharT_ char-type
+ * @tparam Extent_ extent of the destination span
+ * @param src the characters to convert
+ * @param dst destination storage
+ * @return std::size_t number of characters written, which is less than std::size(src) if dst is too small
+ */
+template <typename RangeT_, typename CharT_, std::size_t Extent_>
+inline std::size_t toUpper(RangeT_ const &src, std::span<CharT_, Extent_> dst)
+requires(std::ranges::contiguous_range<RangeT_> && std::is_same_v<std::ranges::range_value_t<RangeT_>, CharT_>)
+{
+    auto const len = std::min(std::ranges::size(src), std::size(dst));
+    detail::convertCase<detail::LetterCase::UPPER>(std::ranges::data(src), std::data(dst), len);
+
+    return len;
+}
+
+/**
+ * @brief Convert a UTF-8 encoded string to all-lower-case in place, with the simple Unicode case mapping.
+ *        Pure-ASCII blocks are converted with SIMD, only non-ASCII characters are decoded and mapped through the
+ *        generated Unicode tables. Bytes that are not valid UTF-8 are kept unchanged. As characters may change their
+ *        encoded length, the string is re-allocated once if it contains non-ASCII characters.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...> of char or char8_t
+ * @param str the string to convert
+ */
+template <typename StringT_>
+inline void utf8ToLowerInPlace(StringT_ &str)
+requires(util::is_std_string_v<StringT_> && sizeof(typename StringT_::value_type) == 1UL)
+{
+    detail::utf8ConvertCaseInPlace<detail::LetterCase::LOWER>(str);
+}
+
+/**
+ * @brief Convert a UTF-8 encoded string to all-upper-case in place, with the simple Unicode case mapping.
+ *        Works like utf8ToLowerInPlace.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...> of char or char8_t
+ * @param str the string to convert
+ */
+template <typename StringT_>
+inline void utf8ToUpperInPlace(StringT_ &str)
+requires(util::is_std_string_v<StringT_> && sizeof(typename StringT_::value_type) == 1UL)
+{
+    detail::utf8ConvertCaseInPlace<detail::LetterCase::UPPER>(str);
+}
+
+namespace detail
+{
+/**
+ * @brief Case-map a UTF-8 encoded view into a new string, sized for the worst case and trimmed in the same
+ *        allocation.
+ *
+ * @tparam Case_ target case
+ * @tparam ViewT_ std::basic_string_view<...> of a byte-sized char-type
+ * @param view the UTF-8 characters
+ * @return std::basic_string<CharT_, TraitsT_> the mapped string
+ */
+template <LetterCase Case_, typename ViewT_>
+std::basic_string<typename ViewT_::value_type, typename ViewT_::traits_type> utf8CaseMapped(ViewT_ view)
+{
+    std::basic_string<typename ViewT_::value_type, typename ViewT_::traits_type> reval;
+    reval.resize_and_overwrite(utf8CaseMappedCapacity(std::size(view)), [view](auto *buffer, std::size_t) {
+        return utf8ConvertCase<Case_>(
+            reinterpret_cast<unsigned char const *>(std::data(view)),
+            std::size(view),
+            reinterpret_cast<unsigned char *>(buffer)
+        );
+    });
+
+    return reval;
+}
+} // namespace detail
+
+/**
+ * @brief Create an all-lower-case copy of a UTF-8 encoded string or view, with the simple Unicode case mapping.
+ *        Works like utf8ToLowerInPlace, but maps directly into the new string.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...> of char or char8_t
+ * @param str the UTF-8 encoded string
+ * @return std::basic_string<CharT_, TraitsT_> all-lower copy of the string
+ */
+template <typename StringT_>
+inline auto utf8ToLower(StringT_ const &str)
+requires(
+    detail::is_string_or_view_v<StringT_> && sizeof(typename detail::string_view_of_t<StringT_>::value_type) == 1UL
+)
+{
+    return detail::utf8CaseMapped<detail::LetterCase::LOWER>(detail::string_view_of_t<StringT_>{str});
+}
+
+/**
+ * @brief Create an all-upper-case copy of a UTF-8 encoded string or view, with the simple Unicode case mapping.
+ *        Works like utf8ToUpperInPlace, but maps directly into the new string.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...> of char or char8_t
+ * @param str the UTF-8 encoded string
+ * @return std::basic_string<CharT_, TraitsT_> all-upper copy of the string
+ */
+template <typename StringT_>
+inline auto utf8ToUpper(StringT_ const &str)
+requires(
+    detail::is_string_or_view_v<StringT_> && sizeof(typename detail::string_view_of_t<StringT_>::value_type) == 1UL
+)
+{
+    return detail::utf8CaseMapped<detail::LetterCase::UPPER>(detail::string_view_of_t<StringT_>{str});
+}
+
+/**
+ * @brief Find the first byte of a string or view that is not part of a valid UTF-8 character. For a sequence that
+ *        is invalid or cut short by the end, this is the position of its lead byte.
+ *        Works like isValidUtf8.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...> of char or char8_t
+ * @param str the bytes to validate
+ * @return std::size_t position of the first invalid byte, or npos if str is valid UTF-8
+ */
+template <typename StringT_>
+inline std::size_t findInvalidUtf8(StringT_ const &str)
+requires(
+    detail::is_string_or_view_v<StringT_> && sizeof(typename detail::string_view_of_t<StringT_>::value_type) == 1UL
+)
+{
+    auto const view  = detail::string_view_of_t<StringT_>{str};
+    auto const valid =
+        detail::utf8ValidPrefixLength(reinterpret_cast<unsigned char const *>(std::data(view)), std::size(view));
+
+    return valid == std::size(view) ? std::string_view::npos : valid;
+}
+
+/**
+ * @brief Check whether a string or view is valid UTF-8: no overlong encodings, surrogates, code points above U+10FFFF,
+ *        stray continuation bytes or sequences cut short by the end. Validated with the vectorised lookup-table
+ *        algorithm of detail::Utf8Checker where SSSE3 is available, which keeps up with memory bandwidth.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...> of char or char8_t
+ * @param str the bytes to validate
+ * @return true, if str is valid UTF-8, false otherwise
+ */
+template <typename StringT_>
+inline bool isValidUtf8(StringT_ const &str)
+requires(
+    detail::is_string_or_view_v<StringT_> && sizeof(typename detail::string_view_of_t<StringT_>::value_type) == 1UL
+)
+{
+    return findInvalidUtf8(str) == std::string_view::npos;
+}
+
+/**
+ * @brief Strip left and/or right and/or interior of string.
+ *        Works in place: the strip-set is turned into a membership table once and the remaining characters are
+ *        compacted towards the front of str in a single pass.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str original string
+ * @param stripChars characters to strip
+ * @param mode strip mode
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+void strip(StringT_ &str, ConstStringT_ const &stripChars = ConstStringT_{0}, StripTrimMode mode = StripTrimMode::ALL)
+{
+    if (std::empty(str))
+    {
+        return;
+    }
+    using char_type   = typename StringT_::value_type;
+    using traits_type = typename StringT_::traits_type;
+
+    // an empty set of characters leaves both ends alone, but strips white-space inside
+    auto const outsideChars = detail::asStringView<char_type, traits_type>(stripChars);
+    auto const insideChars =
+        std::empty(outsideChars) ? detail::defaultWhitespace<char_type, traits_type>() : outsideChars;
+
+    detail::CharMembership<char_type, traits_type> outside{outsideChars};
+    detail::CharMembership<char_type, traits_type> inside{insideChars};
+    detail::stripInPlace(str, outside, inside, mode);
+}
+
+/**
+ * @brief Strip left and/or right and/or interior of string, using a pre-built character set.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @param stripChars characters to strip, f.e. util::CharClass::WHITESPACE
+ * @param mode strip mode
+ */
+template <typename StringT_>
+void strip(StringT_ &str, CharSet const &stripChars, StripTrimMode mode = StripTrimMode::ALL)
+requires(util::is_std_string_v<StringT_>)
+{
+    detail::stripInPlace(str, stripChars, stripChars, mode);
+}
+
+/**
+ * @brief Trim any of a given set of characters from either end of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str original string
+ * @param trimChars characters to trim
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+void trim(StringT_ &str, ConstStringT_ const &trimChars)
+{
+    strip(str, trimChars, StripTrimMode::OUTSIDE);
+}
+
+/**
+ * @brief Trim any character of a character set from either end of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @param trimChars characters to trim, defaults to util::CharClass::WHITESPACE
+ */
+template <typename StringT_>
+inline void trim(StringT_ &str, CharSet const &trimChars = CharClass::WHITESPACE)
+requires(util::is_std_string_v<StringT_>)
+{
+    strip(str, trimChars, StripTrimMode::OUTSIDE);
+}
+
+/**
+ * @brief Trim only left any of a given set of characters from either end of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str original string
+ * @param trimChars characters to trim
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+inline void trimLeft(StringT_ &str, ConstStringT_ const &trimChars = ConstStringT_{0})
+{
+    return (strip(str, trimChars, StripTrimMode::LEFT));
+}
+
+/**
+ * @brief Trim only left any character of a character set.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @param trimChars characters to trim, defaults to util::CharClass::WHITESPACE
+ */
+template <typename StringT_>
+inline void trimLeft(StringT_ &str, CharSet const &trimChars = CharClass::WHITESPACE)
+requires(util::is_std_string_v<StringT_>)
+{
+    strip(str, trimChars, StripTrimMode::LEFT);
+}
+
+/**
+ * @brief Trim only right any of a given set of characters from either end of the given string.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str original string
+ * @param trimChars characters to trim
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+inline void trimRight(StringT_ &str, ConstStringT_ const &trimChars = ConstStringT_{0})
+{
+    return (strip(str, trimChars, StripTrimMode::RIGHT));
+}
+
+/**
+ * @brief Trim only right any character of a character set.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @param trimChars characters to trim, defaults to util::CharClass::WHITESPACE
+ */
+template <typename StringT_>
+inline void trimRight(StringT_ &str, CharSet const &trimChars = CharClass::WHITESPACE)
+requires(util::is_std_string_v<StringT_>)
+{
+    strip(str, trimChars, StripTrimMode::RIGHT);
+}
+
+/**
+ * @brief Strip the front and/or back of a string without copying: the result is a view into str.
+ *        As the interior of a view cannot be removed, only the FRONT and BACK bits of mode are honoured.
+ *        The characters are matched with the traits of str, so case-insensitive views strip both cases.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str the string to strip, must outlive the result
+ * @param stripChars characters to strip
+ * @param mode strip mode
+ * @return std::basic_string_view<CharT_, TraitsT_> view of the remaining characters of str
+ */
+template <typename StringT_, typename ConstStringT_>
+detail::string_view_of_t<StringT_>
+    strippedView(StringT_ const &str, ConstStringT_ const &stripChars, StripTrimMode mode = StripTrimMode::OUTSIDE)
+requires(detail::is_string_or_view_v<StringT_> && !std::is_same_v<ConstStringT_, CharSet>)
+{
+    using view_type = detail::string_view_of_t<StringT_>;
+    using char_type = typename view_type::value_type;
+
+    auto const view = view_type{str};
+    detail::CharMembership<char_type, typename view_type::traits_type> membership{
+        detail::asStringView<char_type, typename view_type::traits_type>(stripChars)
+    };
+    auto const [start, finish] = detail::keptRange(std::data(view), std::size(view), membership, mode);
+
+    return view.substr(start, finish - start);
+}
+
+/**
+ * @brief Strip the front and/or back of a string without copying, using a pre-built character set.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str the string to strip, must outlive the result
+ * @param stripChars characters to strip
+ * @param mode strip mode, only FRONT and BACK are honoured
+ * @return std::basic_string_view<CharT_, TraitsT_> view of the remaining characters of str
+ */
+template <typename StringT_>
+detail::string_view_of_t<StringT_>
+    strippedView(StringT_ const &str, CharSet const &stripChars, StripTrimMode mode = StripTrimMode::OUTSIDE)
+requires(detail::is_string_or_view_v<StringT_>)
+{
+    auto const view            = detail::string_view_of_t<StringT_>{str};
+    auto const [start, finish] = detail::keptRange(std::data(view), std::size(view), stripChars, mode);
+
+    return view.substr(start, finish - start);
+}
+
+/**
+ * @brief Trim a string on both ends without copying: the result is a view into str.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @param str the string to trim, must outlive the result
+ * @param trimChars characters to trim
+ * @return std::basic_string_view<CharT_, TraitsT_> view of the remaining characters of str
+ */
+template <typename StringT_, typename ConstStringT_>
+inline detail::string_view_of_t<StringT_> trimmedView(StringT_ const &str, ConstStringT_ const &trimChars)
+requires(detail::is_string_or_view_v<StringT_> && !std::is_same_v<ConstStringT_, CharSet>)
+{
+    return strippedView(str, trimChars, StripTrimMode::OUTSIDE);
+}
+
+/**
+ * @brief Trim a string on both ends without copying, using a pre-built character set.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str the string to trim, must outlive the result
+ * @param trimChars characters to trim, defaults to util::CharClass::WHITESPACE
+ * @return std::basic_string_view<CharT_, TraitsT_> view of the remaining characters of str
+ */
+template <typename StringT_>
+inline detail::string_view_of_t<StringT_>
+    trimmedView(StringT_ const &str, CharSet const &trimChars = CharClass::WHITESPACE)
+requires(detail::is_string_or_view_v<StringT_>)
+{
+    return strippedView(str, trimChars, StripTrimMode::OUTSIDE);
+}
+
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_, typename CharsT_>
+void strippedView(std::basic_string<CharT_, TraitsT_, AllocT_> &&, CharsT_ const &, StripTrimMode = {}) = delete;
+
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_, typename CharsT_>
+void trimmedView(std::basic_string<CharT_, TraitsT_, AllocT_> &&, CharsT_ const &) = delete;
+
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_>
+void trimmedView(std::basic_string<CharT_, TraitsT_, AllocT_> &&) = delete;
+
+/**
+ * @brief Replace occurrences of chars left and/or right  and/or interior of
+ * standard string with replacement char.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace
+ * @param repl replacement char
+ * @param mode trim-mode
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename CharT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+void replaceChar(
+    StringT_ &str,
+    ConstStringT_ const &replChars = ConstStringT_{0},
+    CharT_ replaceWith             = util::charToChar<CharT_>(char{' '}),
+    StripTrimMode mode             = StripTrimMode::ALL
+)
+{
+    if (std::empty(str))
+    {
+        return;
+    }
+    using char_type   = typename StringT_::value_type;
+    using traits_type = typename StringT_::traits_type;
+
+    auto replCharsView = detail::asStringView<char_type, traits_type>(replChars);
+    if (std::empty(replCharsView))
+    {
+        replCharsView = detail::defaultWhitespace<char_type, traits_type>();
+    }
+    detail::CharMembership<char_type, traits_type> membership{replCharsView};
+    detail::replaceCharInPlace(str, membership, replaceWith, mode);
+}
+
+/**
+ * @brief Replace occurrences of the characters of a character set left and/or right and/or interior of
+ * standard string with replacement char.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace, f.e. util::CharClass::PUNCT
+ * @param replaceWith replacement char
+ * @param mode trim-mode
+ */
+template <typename StringT_, typename CharT_>
+void replaceChar(
+    StringT_ &str,
+    CharSet const &replChars,
+    CharT_ replaceWith = util::charToChar<CharT_>(char{' '}),
+    StripTrimMode mode = StripTrimMode::ALL
+)
+requires(util::is_std_string_v<StringT_>)
+{
+    detail::replaceCharInPlace(str, replChars, replaceWith, mode);
+}
+
+/**
+ * @brief Replace only left occurrences of replChars.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace
+ * @param replaceWith replacement char
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename CharT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+inline void replaceCharLeft(
+    StringT_ &str,
+    ConstStringT_ const &replChars = ConstStringT_{0},
+    CharT_ replaceWith             = util::charToChar<CharT_>(char{' '})
+)
+{
+    replaceChar(str, replChars, replaceWith, util::StripTrimMode::LEFT);
+}
+
+/**
+ * @brief Replace only left occurrences of the characters of a character set.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace
+ * @param replaceWith replacement char
+ */
+template <typename StringT_, typename CharT_>
+inline void replaceCharLeft(
+    StringT_ &str,
+    CharSet const &replChars,
+    CharT_ replaceWith = util::charToChar<CharT_>(char{' '})
+)
+requires(util::is_std_string_v<StringT_>)
+{
+    replaceChar(str, replChars, replaceWith, util::StripTrimMode::LEFT);
+}
+
+/**
+ * @brief Replace only right occurrences of replChars.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace
+ * @param replaceWith replacement char
+ */
+template <
+    typename StringT_,
+    typename ConstStringT_,
+    typename CharT_,
+    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
+inline void replaceCharRight(
+    StringT_ &str,
+    ConstStringT_ const &replChars = ConstStringT_{0},
+    CharT_ replaceWith             = util::charToChar<CharT_>(char{' '})
+)
+{
+    replaceChar(str, replChars, replaceWith, util::StripTrimMode::RIGHT);
+}
+
+/**
+ * @brief Replace only right occurrences of the characters of a character set.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam CharT_ char-type
+ * @param str original string
+ * @param replChars characters to replace
+ * @param replaceWith replacement char
+ */
+template <typename StringT_, typename CharT_>
+inline void replaceCharRight(
+    StringT_ &str,
+    CharSet const &replChars,
+    CharT_ replaceWith = util::charToChar<CharT_>(char{' '})
+)
+requires(util::is_std_string_v<StringT_>)
+{
+    replaceChar(str, replChars, replaceWith, util::StripTrimMode::RIGHT);
+}
+
+/**
+ * @brief Translate characters in place, like tr: every occurrence of fromChars[i] becomes toChars[i], in one pass
+ *        through a lookup table (SIMD for byte-sized strings), so that several replaceChar calls can be combined.
+ *        If toChars is shorter than fromChars, its last character is repeated, so translate(str, "\t\r\n", " ")
+ *        is replaceChar(str, "\t\r\n", ' '). If a character occurs more than once in fromChars, its last
+ *        occurrence counts. Case-insensitive strings translate both cases of a from-character.
+ *        The regions follow replaceChar: FRONT and BACK are the leading and trailing runs of from-characters.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam FromStringT_ string-type, can be string-like (char[], ...)
+ * @tparam ToStringT_ string-type, can be string-like (char[], ...)
+ * @param str the string to modify
+ * @param fromChars characters to translate
+ * @param toChars their translations
+ * @param mode trim-mode selecting the regions
+ * @throw std::invalid_argument if fromChars is not empty, but toChars is
+ */
+template <
+    typename StringT_,
+    typename FromStringT_,
+    typename ToStringT_,
+    typename util::is_compatible_string_t<StringT_, FromStringT_> * = nullptr,
+    typename util::is_compatible_string_t<StringT_, ToStringT_>   * = nullptr>
+void translate(
+    StringT_ &str,
+    FromStringT_ const &fromChars,
+    ToStringT_ const &toChars,
+    StripTrimMode mode = StripTrimMode::ALL
+)
+{
+    using char_type   = typename StringT_::value_type;
+    using traits_type = typename StringT_::traits_type;
+
+    detail::CharTranslation<char_type, traits_type> const translation{
+        detail::asStringView<char_type, traits_type>(fromChars),
+        detail::asStringView<char_type, traits_type>(toChars)
+    };
+    if (std::empty(str))
+    {
+        return;
+    }
+    detail::translateInPlace(str, translation, mode);
+}
+
+namespace detail
+{
+/**
+ * @brief Fold a character for the case-insensitive comparison of boolean spellings: ASCII letters are lower-cased,
+ *        other characters keep their code. Non-ASCII characters of wider char-types are mapped to a code no byte of
+ *        a spelling has, as spellings are char strings.
+ *
+ * @tparam CharT_ char-type
+ * @param c the character
+ * @return uint32_t the folded code
+ */
+template <typename CharT_> constexpr uint32_t foldBoolChar(CharT_ c)
+{
+    auto const code = static_cast<uint32_t>(static_cast<std::make_unsigned_t<CharT_>>(c));
+    if (code >= 'A' && code <= 'Z')
+    {
+        return code | 0x20U;
+    }
+
+    return sizeof(CharT_) > 1UL && code > 0x7FU ? 0xFFFF'FFFFU : code;
+}
+
+/**
+ * @brief Seeded FNV-1a hash over the folded characters of a string.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ * @param str the string
+ * @param seed the seed
+ * @return uint32_t the hash
+ */
+template <typename CharT_, typename TraitsT_>
+constexpr uint32_t boolSpellingHash(std::basic_string_view<CharT_, TraitsT_> str, uint32_t seed)
+{
+    auto hash = seed;
+    for (auto c: str)
+    {
+        hash = (hash ^ foldBoolChar(c)) * 16'777'619U;
+    }
+
+    return hash ^ (hash >> 15U);
+}
+} // namespace detail
+
+/**
+ * @brief A spelling of a boolean value.
+ */
+struct BoolSpelling
+{
+    std::string_view text;  ///< the spelling, compared ignoring the ASCII case
+    bool             value; ///< the value it stands for
+};
+
+/**
+ * @brief Compile-time vocabulary of boolean spellings for scanBoolString(), compared case-insensitively (ASCII).
+ *        The vocabulary is a perfect-hash table: a lookup rejects strings by length first, then hashes the folded
+ *        characters once and compares with the only spelling that can match, so it neither allocates nor walks a
+ *        tree, and a custom vocabulary costs the same as the built-in one.
+ *        Define it as a constexpr variable and pass it as template argument:
+ *        @code
+ *        inline constexpr util::BoolVocabulary GERMAN{{{"ja", true}, {"nein", false}, {"an", true}, {"aus", false}}};
+ *        inline constexpr auto                 ANY    = util::BOOL_VOCABULARY | GERMAN;
+ *        util::scanBoolString<GERMAN>(str, result);
+ *        util::scanBoolString<ANY>(str, result);
+ *        @endcode
+ *
+ * @tparam N_ number of spellings
+ */
+template <std::size_t N_> class BoolVocabulary
+{
+  public:
+    /**
+     * @brief Build the vocabulary, searching a seed for which no two spellings share a slot.
+     *
+     * @param spellings the spellings and their values
+     * @throw std::invalid_argument if a spelling is empty or two spellings are equal but for the case, which, at
+     *        compile time, is a compilation error
+     */
+    constexpr explicit BoolVocabulary(BoolSpelling const (&spellings)[N_])
+    {
+        for (std::size_t index = 0UL; index < N_; index++)
+        {
+            if (spellings[index].text.empty())
+            {
+                throw std::invalid_argument("util::BoolVocabulary: empty spelling"); // NOSONAR
+            }
+            for (std::size_t other = 0UL; other < index; other++)
+            {
+                if (equalFolded(spellings[other].text, spellings[index].text))
+                {
+                    throw std::invalid_argument("util::BoolVocabulary: duplicate spelling"); // NOSONAR
+                }
+            }
+            minLength_ = std::min(minLength_, std::size(spellings[index].text));
+            maxLength_ = std::max(maxLength_, std::size(spellings[index].text));
+        }
+        for (seed_ = 0x811C'9DC5U;; seed_++)
+        {
+            slots_ = {};
+            if (std::ranges::all_of(spellings, [this](BoolSpelling const &spelling) {
+                    auto &slot = slots_[slotOf(spelling.text)];
+                    if (!slot.text.empty())
+                    {
+                        return false;
+                    }
+                    slot = spelling;
+                    return true;
+                }))
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Look up a string.
+     *
+     * @tparam CharT_ char-type
+     * @tparam TraitsT_ char-traits
+     * @param str the string
+     * @return std::optional<bool> the value of the matching spelling, or std::nullopt if none matches
+     */
+    template <typename CharT_, typename TraitsT_>
+    [[nodiscard]] constexpr std::optional<bool> find(std::basic_string_view<CharT_, TraitsT_> str) const
+    {
+        if (std::size(str) < minLength_ || std::size(str) > maxLength_)
+        {
+            return std::nullopt;
+        }
+        auto const &slot = slots_[slotOf(str)];
+        if (!equalFolded(slot.text, str))
+        {
+            return std::nullopt;
+        }
+
+        return slot.value;
+    }
+
+    /**
+     * @brief The spellings, in no particular order.
+     *
+     * @return std::array<BoolSpelling, N_> the spellings
+     */
+    [[nodiscard]] constexpr std::array<BoolSpelling, N_> spellings() const
+    {
+        std::array<BoolSpelling, N_> reval{};
+        std::ranges::copy_if(slots_, std::begin(reval), [](BoolSpelling const &slot) { return !slot.text.empty(); });
+
+        return reval;
+    }
+
+    /**
+     * @brief Union of two vocabularies.
+     *
+     * @tparam M_ number of spellings of rhs
+     * @param lhs left-hand-side vocabulary
+     * @param rhs right-hand-side vocabulary
+     * @return BoolVocabulary<N_ + M_> vocabulary with the spellings of both, which must not share a spelling
+     */
+    template <std::size_t M_>
+    friend constexpr BoolVocabulary<N_ + M_> operator|(BoolVocabulary const &lhs, BoolVocabulary<M_> const &rhs)
+    {
+        BoolSpelling joined[N_ + M_]{};
+        std::ranges::copy(rhs.spellings(), std::ranges::copy(lhs.spellings(), std::begin(joined)).out);
+
+        return BoolVocabulary<N_ + M_>{joined};
+    }
+
+  private:
+    // a load factor of at most 1/4 lets the seed search succeed after a few thousand tries even for 100 spellings
+    static constexpr std::size_t CAPACITY = std::bit_ceil(std::max(4UL * N_, 8UL));
+
+    template <typename CharT_, typename TraitsT_>
+    [[nodiscard]] constexpr std::size_t slotOf(std::basic_string_view<CharT_, TraitsT_> str) const
+    {
+        return detail::boolSpellingHash(str, seed_) & (CAPACITY - 1UL);
+    }
+
+    template <typename CharT_, typename TraitsT_>
+    static constexpr bool equalFolded(std::string_view spelling, std::basic_string_view<CharT_, TraitsT_> str)
+    {
+        if (std::size(spelling) != std::size(str))
+        {
+            return false;
+        }
+        for (std::size_t index = 0UL; index < std::size(str); index++)
+        {
+            if (detail::foldBoolChar(spelling[index]) != detail::foldBoolChar(str[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::array<BoolSpelling, CAPACITY> slots_{};
+    uint32_t                           seed_      = 0U;
+    std::size_t                        minLength_ = std::numeric_limits<std::size_t>::max();
+    std::size_t                        maxLength_ = 0UL;
+};
+
+/**
+ * @brief The spellings scanBoolString() accepts by default.
+ */
+inline constexpr BoolVocabulary BOOL_VOCABULARY{{
+    {"true",  true },
+    {"t",     true },
+    {"yes",   true },
+    {"y",     true },
+    {"1",     true },
+    {"on",    true },
+    {"false", false},
+    {"f",     false},
+    {"no",    false},
+    {"n",     false},
+    {"0",     false},
+    {"off",   false},
+}};
+
+/**
+ * @brief Try to scan a string representation of a boolean by most common values
+ * like True, on/Off/...
+ * The comparison ignores the (ASCII) case and nothing is allocated: the string is looked up in a compile-time
+ * perfect-hash table of the spellings.
+ *
+ * @tparam Vocabulary_ the accepted spellings, a constexpr BoolVocabulary, defaults to BOOL_VOCABULARY
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...> of any char-type
+ * @param strVal string to parse
+ * @param result result of the scan, false if the string is not a boolean
+ * @return true, if the string successfully parsed into true or false, false otherwise
+ */
+template <auto const &Vocabulary_ = BOOL_VOCABULARY, typename StringT_>
+constexpr bool scanBoolString(StringT_ const &strVal, bool &result)
+requires(detail::is_string_or_view_v<StringT_>)
+{
+    auto const found = Vocabulary_.find(detail::string_view_of_t<StringT_>{strVal});
+    result           = found.value_or(false);
+
+    return found.has_value();
+}
+
+template <typename StringT_>
+StringT_ substr_from_to_incl(StringT_ const &str, size_t start, size_t finish)
+requires(util::is_std_string_v<StringT_>)
+{
+    if (start > static_cast<size_t>(std::size(str)) || start > finish)
+    {
+        return StringT_{};
+    }
+    if (finish > static_cast<size_t>(std::size(str)))
+    {
+        finish = StringT_::npos;
+    }
+    else
+    {
+        finish = finish - start + 1;
+    }
+    return str.substr(start, finish);
+}
+
+/**
+ * @brief Lazy range over the tokens of a string, separated by a character or a string.
+ *        The tokens are views into the original string, so no token is copied.
+ *        The semantics are those of splitIntoVector: n separators yield n + 1 tokens, so that leading, trailing and
+ *        touching separators produce empty tokens, and an empty separator yields the whole string.
+ *        The end of a token is only searched for when the token is read, so that consumers which stop early
+ *        (f.e. via std::views::take) never scan further than one SIMD block beyond the last token they read.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits, used to match the separator
+ */
+template <typename CharT_, typename TraitsT_ = std::char_traits<CharT_>>
+class SplitView : public std::ranges::view_interface<SplitView<CharT_, TraitsT_>>
+{
+  public:
+    using view_type = std::basic_string_view<CharT_, TraitsT_>;
+    using size_type = typename view_type::size_type;
+
+    /**
+     * @brief Forward iterator over the tokens.
+     */
+    class iterator
+    {
+      public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = view_type;
+        using difference_type   = std::ptrdiff_t;
+
+        iterator() = default;
+
+        view_type operator*() const
+        {
+            return parent_->str_.substr(start_, tokenEnd() - start_);
+        }
+
+        iterator &operator++()
+        {
+            auto const finish = tokenEnd();
+            if (finish == std::size(parent_->str_))
+            {
+                start_ = view_type::npos;
+            }
+            else
+            {
+                start_  = finish + parent_->sepLen_;
+                finish_ = view_type::npos;
+            }
+
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            auto reval = *this;
+            ++*this;
+
+            return reval;
+        }
+
+        friend bool operator==(iterator const &lhs, iterator const &rhs)
+        {
+            return lhs.start_ == rhs.start_;
+        }
+
+      private:
+        friend class SplitView;
+
+        iterator(SplitView const *parent, size_type start)
+            : parent_(parent)
+            , start_(start)
+        {
+        }
+
+        size_type tokenEnd() const
+        {
+            if (finish_ == view_type::npos)
+            {
+                finish_ = parent_->separatorFrom(start_, scanner_);
+            }
+
+            return finish_;
+        }
+
+        SplitView const            *parent_ = nullptr;
+        size_type                   start_  = view_type::npos; ///< npos marks the end
+        mutable size_type           finish_ = view_type::npos; ///< npos until the end of the token has been searched
+        mutable detail::ByteScanner scanner_;                  ///< separators found ahead, for single-byte separators
+    };
+
+    /**
+     * @brief Construct an empty range.
+     */
+    SplitView() = default;
+
+    /**
+     * @brief Construct the range of tokens of str separated by the string sep.
+     *
+     * @param str the string to split, must outlive the range
+     * @param sep the separator, must outlive the range
+     */
+    SplitView(view_type str, view_type sep)
+        : str_(str)
+        , sepLen_(std::size(sep))
+    {
+        if (sepLen_ == 1UL)
+        {
+            sepChar_ = sep.front();
+        }
+        else if (sepLen_ > 1UL)
+        {
+            searcher_ = Searcher<CharT_, TraitsT_>{sep};
+        }
+    }
+
+    /**
+     * @brief Construct the range of tokens of str separated by the character sep.
+     *
+     * @param str the string to split, must outlive the range
+     * @param sep the separator character
+     */
+    SplitView(view_type str, CharT_ sep)
+        : str_(str)
+        , sepChar_(sep)
+        , sepLen_(1UL)
+    {
+    }
+
+    /**
+     * @brief Iterator to the first token. No scanning is done until it is dereferenced.
+     *
+     * @return iterator the begin-iterator
+     */
+    [[nodiscard]] iterator begin() const
+    {
+        return iterator{this, 0UL};
+    }
+
+    /**
+     * @brief Iterator past the last token.
+     *
+     * @return iterator the end-iterator
+     */
+    [[nodiscard]] iterator end() const
+    {
+        return iterator{this, view_type::npos};
+    }
+
+  private:
+    /**
+     * @brief Find the end of the token starting at pos.
+     *        Single-byte separators matched with std::char_traits are found by the iterator's ByteScanner, which
+     *        has consumed exactly the separators before pos. Longer separators are found by the precompiled Searcher.
+     *
+     * @param pos start of the token
+     * @param scanner the scanner of the iterator
+     * @return size_type position of the next separator, or the size of the string if there is none
+     */
+    size_type separatorFrom(size_type pos, detail::ByteScanner &scanner) const
+    {
+        size_type found = view_type::npos;
+        if constexpr (sizeof(CharT_) == 1UL && std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+        {
+            if (sepLen_ == 1UL)
+            {
+                return scanner.next(
+                    reinterpret_cast<unsigned char const *>(std::data(str_)),
+                    std::size(str_),
+                    static_cast<unsigned char>(sepChar_)
+                );
+            }
+        }
+        if (sepLen_ == 1UL)
+        {
+            found = str_.find(sepChar_, pos);
+        }
+        else if (sepLen_ > 1UL)
+        {
+            found = searcher_.find(str_, pos);
+        }
+
+        return found == view_type::npos ? std::size(str_) : found;
+    }
+
+    view_type                  str_;
+    Searcher<CharT_, TraitsT_> searcher_;
+    CharT_                     sepChar_{};
+    size_type                  sepLen_ = 0UL;
+};
+
+namespace detail
+{
+/**
+ * @brief Check whether SeparatorT_ can be used to split strings of char-type CharT_: either a single character or a
+ *        string-like object (std::basic_string, string_view, char-array or char-pointer) of CharT_.
+ */
+template <typename SeparatorT_, typename CharT_>
+inline constexpr bool is_separator_for_v =
+    std::is_same_v<std::remove_cvref_t<SeparatorT_>, CharT_>
+    || std::is_same_v<std::remove_cv_t<std::remove_pointer_t<std::decay_t<SeparatorT_>>>, CharT_>
+    || requires(SeparatorT_ const &sep) {
+           { std::data(sep) } -> std::convertible_to<CharT_ const *>;
+           std::size(sep);
+       };
+
+/**
+ * @brief Create the split-range of a view, dispatching on whether the separator is a character or a string.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param view view of the string to split
+ * @param sep the separator
+ * @return SplitView<CharT_, TraitsT_> the lazy range of tokens
+ */
+template <typename ViewT_, typename SeparatorT_>
+SplitView<typename ViewT_::value_type, typename ViewT_::traits_type> makeSplitView(ViewT_ view, SeparatorT_ const &sep)
+{
+    using char_type   = typename ViewT_::value_type;
+    using traits_type = typename ViewT_::traits_type;
+
+    if constexpr (std::is_same_v<std::remove_cvref_t<SeparatorT_>, char_type>)
+    {
+        return SplitView<char_type, traits_type>{view, sep};
+    }
+    else
+    {
+        return SplitView<char_type, traits_type>{view, asStringView<char_type, traits_type>(sep)};
+    }
+}
+
+/**
+ * @brief Add a token to a vector or a set of strings or views. The string is constructed in place, so that
+ *        containers with a polymorphic allocator hand their memory resource on to the string.
+ *
+ * @tparam ContainerT_ vector- or set-type of strings or views, or ViewHashSet
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @param results the container to add to
+ * @param token the token
+ */
+template <typename ContainerT_, typename ViewT_> void addToken(ContainerT_ &results, ViewT_ token)
+{
+    if constexpr (requires { results.emplace_back(token); })
+    {
+        results.emplace_back(token);
+    }
+    else if constexpr (requires { results.emplace(token); })
+    {
+        results.emplace(token);
+    }
+    else
+    {
+        results.insert(token);
+    }
+}
+
+/**
+ * @brief The separator as a single byte, if the SIMD separator-bitmask kernel can be used to find it: this is the
+ *        case for single-byte separators (a character or a string of length 1) matched with std::char_traits.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param sep the separator
+ * @return std::optional<unsigned char> the separator byte, or std::nullopt if the kernel cannot be used
+ */
+template <typename ViewT_, typename SeparatorT_> std::optional<unsigned char> byteSeparator(SeparatorT_ const &sep)
+{
+    using char_type   = typename ViewT_::value_type;
+    using traits_type = typename ViewT_::traits_type;
+
+    if constexpr (sizeof(char_type) == 1UL && std::is_same_v<traits_type, std::char_traits<char_type>>)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<SeparatorT_>, char_type>)
+        {
+            return static_cast<unsigned char>(sep);
+        }
+        else if (auto const sepView = asStringView<char_type, traits_type>(sep); std::size(sepView) == 1UL)
+        {
+            return static_cast<unsigned char>(sepView.front());
+        }
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Call onToken for every token of view, the tokens being exactly those of makeSplitView(view, sep).
+ *        A byteSeparator is located by the SIMD separator-bitmask kernel, which produces all token boundaries in
+ *        one pass; any other separator falls back to the lazy SplitView.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @tparam Func_ callable taking a ViewT_
+ * @param view view of the string to split
+ * @param sep the separator
+ * @param onToken callback receiving the tokens in order
+ */
+template <typename ViewT_, typename SeparatorT_, typename Func_>
+void forEachToken(ViewT_ view, SeparatorT_ const &sep, Func_ &&onToken)
+{
+    if (auto const byteSep = byteSeparator<ViewT_>(sep); byteSep.has_value())
+    {
+        typename ViewT_::size_type start = 0UL;
+        forEachByteOf(
+            reinterpret_cast<unsigned char const *>(std::data(view)),
+            std::size(view),
+            *byteSep,
+            [&](std::size_t pos) {
+                onToken(view.substr(start, pos - start));
+                start = pos + 1UL;
+            }
+        );
+        onToken(view.substr(start));
+        return;
+    }
+    for (auto const token: makeSplitView(view, sep))
+    {
+        onToken(token);
+    }
+}
+
+/**
+ * @brief Call onToken for every token of view, the tokens being separated by any of the delimiter characters.
+ *        Byte-sized strings are searched for all delimiters at once by the SIMD set-matching kernel, so the string
+ *        is walked exactly once, however many delimiters there are.
+ *
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam Func_ callable taking a ViewT_
+ * @param view view of the string to split
+ * @param delimiters the delimiter characters
+ * @param mode whether runs of delimiters count as a single delimiter
+ * @param onToken callback receiving the tokens in order
+ */
+template <typename ViewT_, typename Func_>
+void forEachToken(ViewT_ view, CharSet const &delimiters, DelimiterMode mode, Func_ &&onToken)
+{
+    typename ViewT_::size_type start = 0UL;
+
+    auto const onDelimiter = [&](std::size_t pos) {
+        // start is only ever moved past a delimiter, so pos == start > 0 means the delimiter continues a run
+        if (mode != DelimiterMode::COLLAPSE_RUNS || pos != start || pos == 0UL)
+        {
+            onToken(view.substr(start, pos - start));
+        }
+        start = pos + 1UL;
+    };
+
+    if constexpr (sizeof(typename ViewT_::value_type) == 1UL)
+    {
+        ByteSetMatcher const matcher{delimiters.bytes()};
+        auto const          *bytes = reinterpret_cast<unsigned char const *>(std::data(view));
+        forEachByteInSet(bytes, std::size(view), matcher, onDelimiter);
+    }
+    else
+    {
+        for (std::size_t pos = 0UL; pos < std::size(view); ++pos)
+        {
+            if (delimiters.contains(view[pos]))
+            {
+                onDelimiter(pos);
+            }
+        }
+    }
+    onToken(view.substr(start));
+}
+
+/**
+ * @brief Add the tokens of view to a vector or a set. Vectors are reserved up-front for byteSeparators.
+ *
+ * @tparam ContainerT_ vector- or set-type of strings, possibly with a polymorphic allocator
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param results the container to add to
+ * @param view view of the string to split
+ * @param sep the separator
+ */
+template <typename ContainerT_, typename ViewT_, typename SeparatorT_>
+void splitInto(ContainerT_ &results, ViewT_ view, SeparatorT_ const &sep)
+{
+    if constexpr (requires { results.reserve(1UL); })
+    {
+        if (auto const byteSep = byteSeparator<ViewT_>(sep); byteSep.has_value())
+        {
+            // counting the separators costs a fraction of the split and saves all re-allocations of the vector
+            auto const *bytes = reinterpret_cast<unsigned char const *>(std::data(view));
+            results.reserve(1UL + countByteOf(bytes, std::size(view), *byteSep));
+        }
+    }
+    forEachToken(view, sep, [&results](auto token) { addToken(results, token); });
+}
+
+/**
+ * @brief Add the tokens of view, separated by any of the delimiters, to a vector or a set.
+ *
+ * @tparam ContainerT_ vector- or set-type of strings, possibly with a polymorphic allocator
+ * @tparam ViewT_ std::basic_string_view<...>
+ * @param results the container to add to
+ * @param view view of the string to split
+ * @param delimiters the delimiter characters
+ * @param mode whether runs of delimiters count as a single delimiter
+ */
+template <typename ContainerT_, typename ViewT_>
+void splitInto(ContainerT_ &results, ViewT_ view, CharSet const &delimiters, DelimiterMode mode)
+{
+    forEachToken(view, delimiters, mode, [&results](auto token) { addToken(results, token); });
+}
+} // namespace detail
+
+/**
+ * @brief Find the first occurrence of a needle in a string, like std::basic_string::find, but with the precompiled
+ *        util::Searcher, which filters short needles with SIMD and skips through long ones with Boyer-Moore-Horspool.
+ *        The needle is matched with the traits of the haystack, so util::ci_string finds all case-variants, folding
+ *        ASCII characters with SIMD. See util::ciFind for case-insensitive search in strings with std::char_traits.
+ *        To search for the same needle many times, construct a util::Searcher once instead.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam NeedleT_ needle type, either CharT_ or string-like
+ * @param haystack the string to search
+ * @param needle the character or string to search for
+ * @param pos the position to start the search at
+ * @return size_type position of the first occurrence, or npos if there is none
+ */
+template <typename StringT_, typename NeedleT_>
+typename detail::string_view_of_t<StringT_>::size_type find(
+    StringT_ const                                        &haystack,
+    NeedleT_ const                                        &needle,
+    typename detail::string_view_of_t<StringT_>::size_type pos = 0UL
+)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<NeedleT_, typename detail::string_view_of_t<StringT_>::value_type>)
+{
+    using view_type   = detail::string_view_of_t<StringT_>;
+    using char_type   = typename view_type::value_type;
+    using traits_type = typename view_type::traits_type;
+
+    if constexpr (std::is_same_v<std::remove_cvref_t<NeedleT_>, char_type>)
+    {
+        return Searcher<char_type, traits_type>{view_type{&needle, 1UL}}.find(view_type{haystack}, pos);
+    }
+    else
+    {
+        Searcher<char_type, traits_type> const searcher{detail::asStringView<char_type, traits_type>(needle)};
+
+        return searcher.find(view_type{haystack}, pos);
+    }
+}
+
+/**
+ * @brief Split a string lazily into views of its tokens, without allocating.
+ *        Tokens are the same as the elements of splitIntoVector(str, sep), but views into str. The separator is matched
+ *        with the traits of str, so case-insensitive strings are split at both cases of the separator.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param str the string to split, must outlive the range
+ * @param sep the separator, when it is a string it must outlive the range
+ * @return SplitView<CharT_, TraitsT_> forward range of std::basic_string_view<CharT_, TraitsT_>
+ */
+template <typename StringT_, typename SeparatorT_>
+auto splitView(StringT_ const &str, SeparatorT_ const &sep)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
+{
+    return detail::makeSplitView(detail::string_view_of_t<StringT_>{str}, sep);
+}
+
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_, typename SeparatorT_>
+void splitView(std::basic_string<CharT_, TraitsT_, AllocT_> &&, SeparatorT_ const &) = delete;
+
+/**
+ * @brief  Split a string into a vector of strings using a char sep as separator.
+ *         Single-byte separators are located in bulk by the SIMD separator-bitmask kernel.
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string
+ * @param str original string
+ * @param sep separator character
+ * @return std::vector<std::basic_string<CharT_, TraitsT_>> a vector containing the separated sub-strings
+ */
+template <typename StringT_, typename SeparatorT_>
+std::vector<StringT_> splitIntoVector(StringT_ const &str, SeparatorT_ sep)
+requires(util::has_std_string_compatible_char_v<StringT_, SeparatorT_> && !std::is_same_v<SeparatorT_, CharSet>)
+{
+    std::vector<StringT_> results;
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, sep);
 
-    str = reval;
+    return results;
 }
 
 /**
- * @brief Trim any of a given set of characters from either end of the given string.
+ * @brief  Split a string into a vector of strings, allocating the vector and all strings from a memory resource,
+ *         f.e. a std::pmr::monotonic_buffer_resource that is released in one go when the work is done.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string
  * @param str original string
- * @param trimChars characters to trim
+ * @param sep separator character
+ * @param resource memory resource for the vector and the strings
+ * @return std::pmr::vector<std::pmr::basic_string<CharT_, TraitsT_>> a vector containing the separated sub-strings
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-void trim(StringT_ &str, ConstStringT_ const &trimChars)
+template <typename StringT_, typename SeparatorT_>
+std::pmr::vector<detail::pmr_string_of_t<StringT_>>
+    splitIntoVector(StringT_ const &str, SeparatorT_ sep, std::pmr::memory_resource *resource)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
 {
-    strip(str, trimChars, StripTrimMode::OUTSIDE);
+    std::pmr::vector<detail::pmr_string_of_t<StringT_>> results{resource};
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, sep);
+
+    return results;
 }
 
 /**
- * @brief Trim only left any of a given set of characters from either end of the given string.
+ * @brief  Split a string into a set of strings using a char sep as separator.
+ *         Single-byte separators are located in bulk by the SIMD separator-bitmask kernel.
  *
  * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam SeparatorT_ separator type, needs to be eithe CharT_ or string
  * @param str original string
- * @param trimChars characters to trim
+ * @param sep separator character
+ * @return std::set<StringT_, std::less<>> a set containing the separated sub-strings
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-inline void trimLeft(StringT_ &str, ConstStringT_ const &trimChars = ConstStringT_{0})
+template <typename StringT_, typename SeparatorT_>
+std::set<StringT_, std::less<>> splitIntoSet(StringT_ const &str, SeparatorT_ sep)
+requires(util::has_std_string_compatible_char_v<StringT_, SeparatorT_> && !std::is_same_v<SeparatorT_, CharSet>)
 {
-    return (strip(str, trimChars, StripTrimMode::LEFT));
+    std::set<StringT_, std::less<>> results;
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, sep);
+
+    return results;
 }
 
 /**
- * @brief Trim only right any of a given set of characters from either end of the given string.
+ * @brief  Split a string into a set of strings, allocating the nodes and all strings from a memory resource.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string
  * @param str original string
- * @param trimChars characters to trim
+ * @param sep separator character
+ * @param resource memory resource for the set and the strings
+ * @return std::pmr::set<std::pmr::basic_string<CharT_, TraitsT_>, std::less<>> a set containing the separated
+ *         sub-strings
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-inline void trimRight(StringT_ &str, ConstStringT_ const &trimChars = ConstStringT_{0})
+template <typename StringT_, typename SeparatorT_>
+std::pmr::set<detail::pmr_string_of_t<StringT_>, std::less<>>
+    splitIntoSet(StringT_ const &str, SeparatorT_ sep, std::pmr::memory_resource *resource)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
 {
-    return (strip(str, trimChars, StripTrimMode::RIGHT));
+    std::pmr::set<detail::pmr_string_of_t<StringT_>, std::less<>> results{resource};
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, sep);
+
+    return results;
 }
 
 /**
- * @brief Replace occurrences of chars left and/or right  and/or interior of
- * standard string with replacement char.
+ * @brief  Collect the unique tokens of a string into an open-addressing hash set of views, without copying them.
+ *         This is the alternative to splitIntoSet when the result is only used for membership tests: building it
+ *         allocates a single flat array, and a lookup probes adjacent slots rather than walking a tree.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
- * @tparam CharT_ char-type
- * @param str original string
- * @param replChars characters to replace
- * @param repl replacement char
- * @param mode trim-mode
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param str original string, must outlive the result
+ * @param sep separator character
+ * @return ViewHashSet<CharT_, TraitsT_> the set of unique tokens
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename CharT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-void replaceChar(
-    StringT_ &str,
-    ConstStringT_ const &replChars = ConstStringT_{0},
-    CharT_ replaceWith             = util::charToChar<CharT_>(char{' '}),
-    StripTrimMode mode             = StripTrimMode::ALL
-)
+template <typename StringT_, typename SeparatorT_>
+ViewHashSet<
+    typename detail::string_view_of_t<StringT_>::value_type,
+    typename detail::string_view_of_t<StringT_>::traits_type>
+    splitIntoHashSet(StringT_ const &str, SeparatorT_ const &sep)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
 {
-    if (std::empty(str))
-    {
-        return;
-    }
+    using view_type = detail::string_view_of_t<StringT_>;
 
-    auto stringReplChars = StringT_{replChars};
-    if (std::empty(stringReplChars))
-    {
-        stringReplChars = util::convert<StringT_>(std::string{"\n\t \r"});
-    }
-    if (str.find_first_not_of(stringReplChars) == StringT_::npos)
-    {
-        str = StringT_(std::size(str), replaceWith);
-        return;
-    }
+    ViewHashSet<typename view_type::value_type, typename view_type::traits_type> results;
+    detail::splitInto(results, view_type{str}, sep);
 
-    using enum StripTrimMode;
-    size_t firstNonReplChar = 0;
+    return results;
+}
 
-    while (firstNonReplChar < std::size(str) && stringReplChars.contains(str[firstNonReplChar]))
-    {
-        if (isModeSet(mode, FRONT))
-        {
-            str[firstNonReplChar] = replaceWith;
-        }
+/**
+ * @brief  Collect the unique tokens of a string into a sorted, de-duplicated flat vector of views, without copying
+ *         them. Membership is tested with std::ranges::binary_search; of equal tokens (f.e. of case-insensitive
+ *         strings) the first one in str is kept.
+ *
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @tparam SeparatorT_ separator type, needs to be either CharT_ or string-like
+ * @param str original string, must outlive the result
+ * @param sep separator character
+ * @return std::vector<std::basic_string_view<CharT_, TraitsT_>> the sorted unique tokens
+ */
+template <typename StringT_, typename SeparatorT_>
+std::vector<detail::string_view_of_t<StringT_>> splitIntoSortedViews(StringT_ const &str, SeparatorT_ const &sep)
+requires(detail::is_string_or_view_v<StringT_>
+         && detail::is_separator_for_v<SeparatorT_, typename detail::string_view_of_t<StringT_>::value_type>)
+{
+    std::vector<detail::string_view_of_t<StringT_>> results;
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, sep);
+    std::ranges::stable_sort(results);
+    auto const duplicates = std::ranges::unique(results);
+    results.erase(duplicates.begin(), duplicates.end());
 
-        firstNonReplChar++;
-    }
+    return results;
+}
 
-    size_t lastNonReplChar = std::size(str) - 1;
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_, typename SeparatorT_>
+void splitIntoHashSet(std::basic_string<CharT_, TraitsT_, AllocT_> &&, SeparatorT_ const &) = delete;
 
-    while (stringReplChars.contains(str[lastNonReplChar]))
-    {
-        if (isModeSet(mode, BACK))
-        {
-            str[lastNonReplChar] = replaceWith;
-        }
-        lastNonReplChar--;
-    }
+/**
+ * @brief Views into temporary strings would dangle, so they are not allowed.
+ */
+template <typename CharT_, typename TraitsT_, typename AllocT_, typename SeparatorT_>
+void splitIntoSortedViews(std::basic_string<CharT_, TraitsT_, AllocT_> &&, SeparatorT_ const &) = delete;
 
-    size_t insideNonReplChar = firstNonReplChar;
+/**
+ * @brief  Split a string into a vector of strings at any of a set of delimiter characters, in a single pass.
+ *         With DelimiterMode::EACH the result is the same as splitting at each delimiter in turn; with
+ *         DelimiterMode::COLLAPSE_RUNS a run of delimiters (f.e. any white-space) separates two tokens only once.
+ *         A leading or trailing run still yields one empty token, trim the string first to avoid these.
+ *
+ * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @param str original string
+ * @param delimiters the delimiter characters
+ * @param mode treatment of consecutive delimiters, defaults to DelimiterMode::EACH
+ * @return std::vector<StringT_> a vector containing the separated sub-strings
+ */
+template <typename StringT_>
+std::vector<StringT_>
+    splitIntoVector(StringT_ const &str, CharSet const &delimiters, DelimiterMode mode = DelimiterMode::EACH)
+requires(util::is_std_string_v<StringT_>)
+{
+    std::vector<StringT_> results;
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, delimiters, mode);
 
-    while (insideNonReplChar < lastNonReplChar + 1)
-    {
-        if (isModeSet(mode, INSIDE) && stringReplChars.contains(str[insideNonReplChar]))
-        {
-            str[insideNonReplChar] = replaceWith;
-        }
-        insideNonReplChar++;
-    }
+    return results;
 }
-} // namespace util
 
 /**
- * @brief Replace only left occurrences of replChars.
+ * @brief  Split a string at any of a set of delimiter characters, allocating from a memory resource.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
- * @tparam CharT_ char-type
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
  * @param str original string
- * @param replChars characters to replace
- * @param replaceWith replacement char
+ * @param delimiters the delimiter characters
+ * @param mode treatment of consecutive delimiters
+ * @param resource memory resource for the vector and the strings
+ * @return std::pmr::vector<std::pmr::basic_string<CharT_, TraitsT_>> a vector containing the separated sub-strings
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename CharT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-inline void replaceCharLeft(
-    StringT_ &str,
-    ConstStringT_ const &replChars = ConstStringT_{0},
-    CharT_ replaceWith             = util::charToChar<CharT_>(char{' '})
+template <typename StringT_>
+std::pmr::vector<detail::pmr_string_of_t<StringT_>> splitIntoVector(
+    StringT_ const            &str,
+    CharSet const             &delimiters,
+    DelimiterMode              mode,
+    std::pmr::memory_resource *resource
 )
+requires(detail::is_string_or_view_v<StringT_>)
 {
-    replaceChar(str, replChars, replaceWith, util::StripTrimMode::LEFT);
+    std::pmr::vector<detail::pmr_string_of_t<StringT_>> results{resource};
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, delimiters, mode);
+
+    return results;
 }
 
 /**
- * @brief Replace only right occurrences of replChars.
+ * @brief  Split a string into a set of strings at any of a set of delimiter characters, in a single pass.
  *
  * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam ConstStringT_ string-type, can be string-like (char[], ...)
- * @tparam CharT_ char-type
  * @param str original string
- * @param replChars characters to replace
- * @param replaceWith replacement char
+ * @param delimiters the delimiter characters
+ * @param mode treatment of consecutive delimiters, defaults to DelimiterMode::EACH
+ * @return std::set<StringT_, std::less<>> a set containing the separated sub-strings
  */
-template <
-    typename StringT_,
-    typename ConstStringT_,
-    typename util::is_compatible_string_t<StringT_, ConstStringT_> * = nullptr>
-inline void replaceCharRight(StringT_ &str, StringT_ const &stripChars = "\t \r\n", char repl = ' ')
+template <typename StringT_>
+std::set<StringT_, std::less<>>
+    splitIntoSet(StringT_ const &str, CharSet const &delimiters, DelimiterMode mode = DelimiterMode::EACH)
+requires(util::is_std_string_v<StringT_>)
 {
-    replaceChar(str, stripChars, repl, util::StripTrimMode::RIGHT);
+    std::set<StringT_, std::less<>> results;
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, delimiters, mode);
+
+    return results;
 }
 
 /**
- * @brief Try to scan a string representation of a boolean by most common values
- * like True, on/Off/...
+ * @brief  Split a string into a set of strings at any of a set of delimiter characters, allocating from a memory
+ *         resource.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @param strVal string to parse
- * @param result result of the scan
- * @return true, if the string successfully parsed into true or false, false otherwise
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str original string
+ * @param delimiters the delimiter characters
+ * @param mode treatment of consecutive delimiters
+ * @param resource memory resource for the set and the strings
+ * @return std::pmr::set<std::pmr::basic_string<CharT_, TraitsT_>, std::less<>> a set containing the separated
+ *         sub-strings
  */
 template <typename StringT_>
-bool scanBoolString(StringT_ const &strVal, bool &result)
-requires(util::is_std_string_v<StringT_>)
+std::pmr::set<detail::pmr_string_of_t<StringT_>, std::less<>> splitIntoSet(
+    StringT_ const            &str,
+    CharSet const             &delimiters,
+    DelimiterMode              mode,
+    std::pmr::memory_resource *resource
+)
+requires(detail::is_string_or_view_v<StringT_>)
 {
-    static std::map<std::string, bool, std::less<>> const VALID_BOOL = {
-        {"true",  true },
-        {"t",     true },
-        {"yes",   true },
-        {"y",     true },
-        {"1",     true },
-        {"on",    true },
-        {"false", false},
-        {"f",     false},
-        {"no",    false},
-        {"n",     false},
-        {"0",     false},
-        {"off",   false}
-    };
+    std::pmr::set<detail::pmr_string_of_t<StringT_>, std::less<>> results{resource};
+    detail::splitInto(results, detail::string_view_of_t<StringT_>{str}, delimiters, mode);
 
-    auto lower = util::convert<std::string>(util::toLower(strVal));
-    auto found = VALID_BOOL.find(lower);
+    return results;
+}
 
-    result = found != VALID_BOOL.end() ? found->second : false;
+/**
+ * @brief Value of a parsed number: the alternative held corresponds to the NumberClass, in the same order
+ *        (std::monostate for NONE, int64_t for INT, uint64_t for UINT and double for FLOAT).
+ */
+using NumberValue = std::variant<std::monostate, int64_t, uint64_t, double>;
 
-    return found != VALID_BOOL.end();
+/**
+ * @brief The class of a parsed number.
+ *
+ * @param value the parsed number
+ * @return NumberClass the class corresponding to the alternative held by value
+ */
+constexpr NumberClass numberClass(NumberValue const &value)
+{
+    return static_cast<NumberClass>(value.index());
 }
 
-template <typename StringT_>
-StringT_ substr_from_to_incl(StringT_ const &str, size_t start, size_t finish)
-requires(util::is_std_string_v<StringT_>)
+static_assert(numberClass(NumberValue{int64_t{}}) == NumberClass::INT
+                  && numberClass(NumberValue{uint64_t{}}) == NumberClass::UINT
+                  && numberClass(NumberValue{double{}}) == NumberClass::FLOAT,
+              "the alternatives of NumberValue need to be in the order of NumberClass");
+
+namespace detail
 {
-    if (start > static_cast<size_t>(std::size(str)) || start > finish)
-    {
-        return StringT_{};
-    }
-    if (finish > static_cast<size_t>(std::size(str)))
-    {
-        finish = StringT_::npos;
-    }
-    else
-    {
-        finish = finish - start + 1;
-    }
-    return str.substr(start, finish);
-}
+/**
+ * @brief Longest string of a wide char-type parseNumber() accepts; it is narrowed into a buffer of that size.
+ */
+inline constexpr std::size_t MAX_WIDE_NUMBER_LENGTH = 128UL;
 
 /**
- * @brief  Split a string into a vector of strings using a char sep as separator.
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam SeparatorT_ separator type, needs to be either CharT_ or string
- * @param str original string
- * @param sep separator character
- * @return std::vector<std::basic_string<CharT_, TraitsT_>> a vector containing the separated sub-strings
+ * @brief Parse a number from a view of chars, see util::parseNumber().
+ *
+ * @param view the characters
+ * @return NumberValue the value, or std::monostate if view is not a number
  */
-template <typename StringT_, typename SeparatorT_>
-std::vector<StringT_> splitIntoVector(StringT_ const &str, SeparatorT_ sep)
-requires(util::has_std_string_compatible_char_v<StringT_, SeparatorT_>)
+inline NumberValue parseNumber(std::string_view view)
 {
-    std::vector<StringT_>        results;
-    typename StringT_::size_type subStrStart = 0UL;
-    typename StringT_::size_type sepStart    = str.find(sep);
-    typename StringT_::size_type sepLen      = util::string_or_char_size(sep);
-
-    if (sepLen == 0 || sepStart > std::size(str))
+    auto const signLength = std::size(view) > 0UL && (view[0] == '+' || view[0] == '-') ? 1UL : 0UL;
+    if (signLength == std::size(view))
+    {
+        return {};
+    }
+    // from_chars would accept "inf", "nan" and a '-' after a '+', so the mantissa has to start with a digit or '.'
+    if (auto const lead = view[signLength]; (lead < '0' || lead > '9') && lead != '.')
     {
-        // separator not found or empty so add the whole string to results and return
-        results.emplace_back(str);
-        return results;
+        return {};
     }
+    // from_chars does not accept a leading '+'
+    auto const *const first = std::data(view) + (view[0] == '+' ? 1UL : 0UL);
+    auto const *const last  = std::data(view) + std::size(view);
 
-    bool finished = false;
-    while (!finished)
+    int64_t intValue{};
+    auto [intEnd, intError] = std::from_chars(first, last, intValue);
+    if (intEnd == last)
     {
-        if (sepStart == subStrStart)
+        if (intError == std::errc{})
         {
-            // we have an empty string at the beginning, or 2 separators are touching
-            results.emplace_back();
+            return intValue;
         }
-        else
+        if (view[0] != '-')
         {
-            results.emplace_back(substr_from_to_incl(str, subStrStart, sepStart - 1));
+            uint64_t uintValue{};
+            if (auto [uintEnd, uintError] = std::from_chars(first, last, uintValue); uintError == std::errc{})
+            {
+                return uintValue;
+            }
         }
+    }
 
-        // start looking for another separator after this one
-        subStrStart = sepStart + sepLen;
-        sepStart    = str.find(sep, subStrStart);
-        if (sepStart > std::size(str))
-        {
-            finished = true;
-            results.emplace_back(substr_from_to_incl(str, subStrStart, sepStart - 1));
-        }
+    double floatValue{};
+    auto [floatEnd, floatError] = std::from_chars(first, last, floatValue);
+    if (floatEnd == last && floatError == std::errc{})
+    {
+        return floatValue;
     }
 
-    return results;
+    return {};
 }
+} // namespace detail
 
 /**
- * @brief  Split a string into a set of strings using a char sep as separator.
+ * @brief Classify and parse a number in a single pass, without allocation and independent of the locale.
+ *        The whole string has to be the number: an optional sign, followed by decimal digits, optionally a '.' and a
+ *        decimal exponent; whitespace, suffixes, "inf", "nan" and hexadecimal numbers are not numbers.
+ *        Integers are INT when they fit into int64_t, else UINT when they fit into uint64_t, else FLOAT like all
+ *        numbers with a fraction or an exponent. Floats out of the range of double are not numbers.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
- * @tparam SeparatorT_ separator type, needs to be eithe CharT_ or string
- * @param str original string
- * @param sep separator character
- * @return std::set<StringT_, std::less<>> a set containing the separated sub-strings
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
+ * @param str the string to parse
+ * @return NumberValue the value, holding std::monostate if str is not a number, see numberClass()
  */
-template <typename StringT_, typename SeparatorT_>
-std::set<StringT_, std::less<>> splitIntoSet(StringT_ const &str, SeparatorT_ sep)
-requires(util::has_std_string_compatible_char_v<StringT_, SeparatorT_>)
+template <typename StringT_>
+NumberValue parseNumber(StringT_ const &str)
+requires(detail::is_string_or_view_v<StringT_>)
 {
-    std::set<StringT_, std::less<>> results;
-    typename StringT_::size_type    subStrStart = 0UL;
-    typename StringT_::size_type    sepStart    = str.find(sep);
-    typename StringT_::size_type    sepLen      = util::string_or_char_size(sep);
-
-    if (sepLen == 0 || sepStart > std::size(str))
+    auto const view = detail::string_view_of_t<StringT_>{str};
+    if constexpr (std::is_same_v<typename decltype(view)::value_type, char>)
     {
-        // separator not found or empty so add the whole string to results and return
-        results.emplace(str);
-        return results;
+        return detail::parseNumber(std::string_view{std::data(view), std::size(view)});
     }
-
-    bool finished = false;
-    while (!finished)
+    else
     {
-        if (sepStart == subStrStart)
+        // numbers consist of ASCII characters only, so wider characters are narrowed first
+        std::array<char, detail::MAX_WIDE_NUMBER_LENGTH> narrow{};
+        if (std::size(view) > std::size(narrow))
         {
-            // we have an empty string at the beginning, or 2 separators are touching
-            results.emplace();
+            return {};
         }
-        else
+        for (std::size_t index = 0UL; index < std::size(view); index++)
         {
-            results.emplace(substr_from_to_incl(str, subStrStart, sepStart - 1));
+            auto const code = static_cast<std::make_unsigned_t<typename decltype(view)::value_type>>(view[index]);
+            if (code > 0x7FU)
+            {
+                return {};
+            }
+            narrow[index] = static_cast<char>(code);
         }
 
-        // start looking for another separator after this one
-        subStrStart = sepStart + sepLen;
-        sepStart    = str.find(sep, subStrStart);
-        if (sepStart > std::size(str))
-        {
-            finished = true;
-            results.emplace(substr_from_to_incl(str, subStrStart, sepStart - 1));
-        }
+        return detail::parseNumber(std::string_view{std::data(narrow), std::size(view)});
     }
-
-    return results;
 }
 
 /**
  * @brief Classify a string into one of the classes NONE, INT, UINT, FLOAT.
- * invalid strings have class NONE
- * integral types INT or UINT
- * and valid floating point strings are FLOAT
- * this function is overridden to allow for case-(in-)sensitive strings
+ *        The classes are those of parseNumber(), use that directly when the value is needed as well.
  *
- * @tparam StringT_ string-type, must be std::basic_string<...>
+ * @tparam StringT_ std::basic_string<...> or std::basic_string_view<...>
  * @param str the string to classify
  * @return NumberClass INT, UINT or FLOAT if the string scans as integer, unsigned or float respectively, NONE otherwise
  */
 template <typename StringT_>
 util::NumberClass classifyNumberString(StringT_ const &str)
-requires(util::is_std_string_v<StringT_>)
+requires(detail::is_string_or_view_v<StringT_>)
 {
-    static size_t maxIntLen  = std::size(util::toString(std::numeric_limits<int64_t>::max()));
-    static size_t maxUintLen = std::size(util::toString(std::numeric_limits<uint64_t>::max()));
-
-    using enum util::NumberClass;
-    if (std::empty(str) || str.find_first_not_of("0123456789+-.eElL") != StringT_::npos)
-    {
-        return NONE;
-    }
-
-    if (str.find_first_of(".e") != StringT_::npos)
-    {
-        return FLOAT;
-    }
-
-    bool isNegative = (str[0] == '-');
-    bool isSigned   = (str[0] == '-' || str[0] == '+');
-
-    if (std::size(str) - (isSigned ? 1 : 0) > maxUintLen)
-    {
-        return FLOAT;
-    }
-    else
-    {
-        if (std::size(str) - (isSigned ? 1 : 0) >= maxIntLen)
-        {
-            return (isNegative ? FLOAT : UINT);
-        }
-        else
-        {
-            return INT;
-        }
-    }
+    return numberClass(parseNumber(str));
+}
 } // namespace util
 
 #endif // NS_UTIL_STRINGUTIL_H_INCLUDED
@@ -0,0 +1,392 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/transcode.h
+ * Description: transcoding between UTF-8, UTF-16 and UTF-32 code units
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_TRANSCODE_H_INCLUDED
+#define NS_UTIL_TRANSCODE_H_INCLUDED
+
+#include "simd_kernels.h"
+#include "utf8.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace util::detail
+{
+/**
+ * @brief Unicode encoding of the code units of a char-type.
+ */
+enum class UtfEncoding : int8_t
+{
+    UTF8,  ///< code units of one byte: char, signed char, unsigned char and char8_t
+    UTF16, ///< code units of two bytes: char16_t, and wchar_t where it has two bytes
+    UTF32  ///< code units of four bytes: char32_t, and wchar_t where it has four bytes
+};
+
+/**
+ * @brief The Unicode encoding of the code units of a char-type, determined by its width.
+ *
+ * @tparam CharT_ char-type
+ */
+template <typename CharT_>
+inline constexpr UtfEncoding utf_encoding_of_v = sizeof(CharT_) == 1UL   ? UtfEncoding::UTF8
+                                                 : sizeof(CharT_) == 2UL ? UtfEncoding::UTF16
+                                                                         : UtfEncoding::UTF32;
+
+/**
+ * @brief Code point that replaces code units that are not a valid encoding of a code point.
+ */
+inline constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFDU;
+
+/**
+ * @brief A code point decoded from UTF-8, UTF-16 or UTF-32 and the number of code units it was encoded in.
+ */
+struct DecodedCodePoint
+{
+    char32_t    codePoint; ///< the decoded code point, REPLACEMENT_CHARACTER for invalid code units
+    std::size_t length;    ///< number of code units consumed, at least 1
+};
+
+/**
+ * @brief The value of a code unit, without sign-extension.
+ *
+ * @tparam CharT_ char-type
+ * @param c the code unit
+ * @return char32_t the value of c
+ */
+template <typename CharT_> constexpr char32_t codeUnitValue(CharT_ c)
+{
+    return static_cast<char32_t>(static_cast<std::make_unsigned_t<CharT_>>(c));
+}
+
+/**
+ * @brief Decode one code point in the encoding of CharT_. An invalid code unit (a stray continuation byte or
+ *        surrogate, an overlong or truncated sequence, a value above U+10FFFF) decodes to REPLACEMENT_CHARACTER and
+ *        is skipped on its own.
+ *
+ * @tparam CharT_ char-type
+ * @param src the code units
+ * @param n number of code units available, at least 1
+ * @return DecodedCodePoint the code point and its length
+ */
+template <typename CharT_> inline DecodedCodePoint decodeUtf(CharT_ const *src, std::size_t n)
+{
+    if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF8)
+    {
+        auto const *const bytes = reinterpret_cast<unsigned char const *>(src);
+        if (bytes[0] >= 0xC2U && bytes[0] < 0xE0U && n > 1UL && isUtf8Continuation(bytes[1]))
+        {
+            // the most frequent non-ASCII characters of Latin, Greek and Cyrillic text have 2 bytes
+            return {(static_cast<char32_t>(bytes[0] & 0x1FU) << 6U) | (bytes[1] & 0x3FU), 2UL};
+        }
+        auto const decoded = decodeUtf8(bytes, n);
+        if (decoded.length == 0UL)
+        {
+            return {REPLACEMENT_CHARACTER, 1UL};
+        }
+        return {decoded.codePoint, decoded.length};
+    }
+    else if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF16)
+    {
+        auto const lead = codeUnitValue(src[0]);
+        if (lead < 0xD800U || lead > 0xDFFFU)
+        {
+            return {lead, 1UL};
+        }
+        if (lead <= 0xDBFFU && n > 1UL)
+        {
+            auto const trail = codeUnitValue(src[1]);
+            if (trail >= 0xDC00U && trail <= 0xDFFFU)
+            {
+                return {0x1'0000U + ((lead - 0xD800U) << 10U) + (trail - 0xDC00U), 2UL};
+            }
+        }
+        return {REPLACEMENT_CHARACTER, 1UL};
+    }
+    else
+    {
+        auto const cp = codeUnitValue(src[0]);
+        if (cp > 0x10'FFFFU || (cp >= 0xD800U && cp <= 0xDFFFU))
+        {
+            return {REPLACEMENT_CHARACTER, 1UL};
+        }
+        return {cp, 1UL};
+    }
+}
+
+/**
+ * @brief Number of code units of CharT_ that encode a code point.
+ *
+ * @tparam CharT_ char-type
+ * @param cp the code point, must be a valid Unicode scalar value
+ * @return std::size_t number of code units
+ */
+template <typename CharT_> constexpr std::size_t utfEncodedLength(char32_t cp)
+{
+    if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF8)
+    {
+        return cp < 0x80U ? 1UL : cp < 0x800U ? 2UL : cp < 0x1'0000U ? 3UL : 4UL;
+    }
+    else if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF16)
+    {
+        return cp < 0x1'0000U ? 1UL : 2UL;
+    }
+    else
+    {
+        return 1UL;
+    }
+}
+
+/**
+ * @brief Encode a code point that is not ASCII in the encoding of CharT_.
+ *
+ * @tparam CharT_ char-type
+ * @param cp the code point, must be a valid Unicode scalar value of at least 0x80
+ * @param dst destination, needs space for utfEncodedLength<CharT_>(cp) code units
+ * @return std::size_t number of code units written
+ */
+template <typename CharT_> inline std::size_t encodeUtf(char32_t cp, CharT_ *dst)
+{
+    if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF8)
+    {
+        if (cp < 0x800U)
+        {
+            dst[0] = static_cast<CharT_>(0xC0U | (cp >> 6U));
+            dst[1] = static_cast<CharT_>(0x80U | (cp & 0x3FU));
+            return 2UL;
+        }
+        unsigned char encoded[4];
+        auto const    length = encodeUtf8(cp, encoded);
+        for (std::size_t k = 0UL; k < length; ++k)
+        {
+            dst[k] = static_cast<CharT_>(encoded[k]);
+        }
+        return length;
+    }
+    else if constexpr (utf_encoding_of_v<CharT_> == UtfEncoding::UTF16)
+    {
+        if (cp < 0x1'0000U)
+        {
+            dst[0] = static_cast<CharT_>(cp);
+            return 1UL;
+        }
+        cp -= 0x1'0000U;
+        dst[0] = static_cast<CharT_>(0xD800U + (cp >> 10U));
+        dst[1] = static_cast<CharT_>(0xDC00U + (cp & 0x3FFU));
+        return 2UL;
+    }
+    else
+    {
+        dst[0] = static_cast<CharT_>(cp);
+        return 1UL;
+    }
+}
+
+/**
+ * @brief Number of consecutive ASCII code units transcoded one by one, after which the rest of the ASCII run is
+ *        looked for with SIMD. Text that mixes ASCII and other characters has runs too short to fill a block.
+ */
+inline constexpr std::size_t ASCII_RUN_THRESHOLD = 16UL;
+
+/**
+ * @brief Minimal number of UTF-8 code units counted by validating and counting bytes with SIMD. Shorter strings are
+ *        counted faster by decoding them.
+ */
+inline constexpr std::size_t SIMD_COUNT_THRESHOLD = 64UL;
+
+/**
+ * @brief Number of code units of ToCharT_ that n code units of FromCharT_ are transcoded to. UTF-16 and UTF-32 are
+ *        counted from the values of their code units, valid UTF-8 by its lead bytes after it has been validated with
+ *        SIMD. Short or invalid UTF-8 is decoded, long ASCII runs in it are measured with SIMD.
+ *
+ * @tparam ToCharT_ target char-type
+ * @tparam FromCharT_ source char-type
+ * @param src the code units
+ * @param n number of code units
+ * @return std::size_t number of code units transcode writes
+ */
+template <typename ToCharT_, typename FromCharT_> std::size_t transcodedLength(FromCharT_ const *src, std::size_t n)
+{
+    if constexpr (utf_encoding_of_v<FromCharT_> == UtfEncoding::UTF8
+                  && utf_encoding_of_v<ToCharT_> != UtfEncoding::UTF8)
+    {
+        auto const *const bytes = reinterpret_cast<unsigned char const *>(src);
+        if (n >= SIMD_COUNT_THRESHOLD && utf8ValidPrefixLength(bytes, n) == n)
+        {
+            // every code point has one byte that is not a continuation byte (80..BF), and needs a surrogate pair in
+            // UTF-16 if that is the lead of 4 bytes (F0..F4)
+            auto const codePoints = n - countBytesAtLeast(bytes, n, 0x80U) + countBytesAtLeast(bytes, n, 0xC0U);
+            if constexpr (utf_encoding_of_v<ToCharT_> == UtfEncoding::UTF16)
+            {
+                return codePoints + countBytesAtLeast(bytes, n, 0xF0U);
+            }
+            return codePoints;
+        }
+    }
+
+    if constexpr (utf_encoding_of_v<FromCharT_> != UtfEncoding::UTF8)
+    {
+        // the length of every code unit follows from its value alone, which vectorises; invalid code units become
+        // REPLACEMENT_CHARACTER, that has 3 UTF-8 bytes like a stray surrogate (code units above U+10FFFF are
+        // subtracted), only surrogate pairs need to look at the next code unit
+        // the extra code units are summed in 32 bits, in chunks that cannot overflow, to fill the vectors
+        constexpr std::size_t CHUNK_SIZE = 65'536UL;
+        std::size_t           reval      = n;
+        for (std::size_t chunk = 0UL; chunk < n; chunk += CHUNK_SIZE)
+        {
+            auto const chunkEnd = std::min(n, chunk + CHUNK_SIZE);
+            uint32_t   extra    = 0U;
+            for (std::size_t i = chunk; i < chunkEnd; ++i)
+            {
+                auto const c = static_cast<uint32_t>(codeUnitValue(src[i]));
+                if constexpr (utf_encoding_of_v<ToCharT_> == UtfEncoding::UTF8)
+                {
+                    extra += static_cast<uint32_t>(c >= 0x80U) + static_cast<uint32_t>(c >= 0x800U)
+                             + static_cast<uint32_t>(c >= 0x1'0000U) - static_cast<uint32_t>(c > 0x10'FFFFU);
+                }
+                else if constexpr (utf_encoding_of_v<ToCharT_> == UtfEncoding::UTF16)
+                {
+                    extra += static_cast<uint32_t>(c >= 0x1'0000U && c <= 0x10'FFFFU);
+                }
+            }
+            reval += extra;
+        }
+        if constexpr (utf_encoding_of_v<FromCharT_> == UtfEncoding::UTF16
+                      && utf_encoding_of_v<ToCharT_> != UtfEncoding::UTF16)
+        {
+            // a high surrogate followed by a low one is a pair, that was counted as two stray surrogates
+            constexpr std::size_t PAIR_LENGTH = utf_encoding_of_v<ToCharT_> == UtfEncoding::UTF8 ? 2UL : 1UL;
+            for (std::size_t chunk = 1UL; chunk < n; chunk += CHUNK_SIZE)
+            {
+                auto const chunkEnd = std::min(n, chunk + CHUNK_SIZE);
+                uint32_t   pairs    = 0U;
+                for (std::size_t i = chunk; i < chunkEnd; ++i)
+                {
+                    auto const high = static_cast<uint32_t>(codeUnitValue(src[i - 1UL]));
+                    auto const low  = static_cast<uint32_t>(codeUnitValue(src[i]));
+                    pairs += static_cast<uint32_t>((high & 0xFC00U) == 0xD800U && (low & 0xFC00U) == 0xDC00U);
+                }
+                reval -= PAIR_LENGTH * pairs;
+            }
+        }
+        return reval;
+    }
+
+    std::size_t i         = 0UL;
+    std::size_t reval     = 0UL;
+    std::size_t asciiSeen = ASCII_RUN_THRESHOLD - 1UL; // a leading ASCII character starts a look for a run
+    while (i < n)
+    {
+        if (isAsciiChar(src[i]))
+        {
+            ++i;
+            ++reval;
+            if (++asciiSeen == ASCII_RUN_THRESHOLD)
+            {
+                auto const run = asciiRunLength(src + i, n - i);
+                i += run;
+                reval += run;
+                asciiSeen = 0UL;
+            }
+        }
+        else
+        {
+            auto const decoded = decodeUtf(src + i, n - i);
+            i += decoded.length;
+            reval += utfEncodedLength<ToCharT_>(decoded.codePoint);
+            asciiSeen = 0UL;
+        }
+    }
+
+    return reval;
+}
+
+/**
+ * @brief Transcode code units from the encoding of FromCharT_ to that of ToCharT_. ASCII code units are copied, long
+ *        runs of them widened or narrowed with SIMD; all other code points are decoded and encoded again, invalid code
+ *        units become REPLACEMENT_CHARACTER.
+ *
+ * @tparam ToCharT_ target char-type
+ * @tparam FromCharT_ source char-type
+ * @param src the code units
+ * @param n number of code units
+ * @param dst destination, needs transcodedLength<ToCharT_>(src, n) code units
+ * @return std::size_t number of code units written
+ */
+template <typename ToCharT_, typename FromCharT_>
+std::size_t transcode(FromCharT_ const *src, std::size_t n, ToCharT_ *dst)
+{
+    std::size_t i         = 0UL;
+    std::size_t o         = 0UL;
+    std::size_t asciiSeen = ASCII_RUN_THRESHOLD - 1UL; // a leading ASCII character starts a look for a run
+    while (i < n)
+    {
+        if (isAsciiChar(src[i]))
+        {
+            dst[o++] = static_cast<ToCharT_>(src[i++]);
+            if (++asciiSeen == ASCII_RUN_THRESHOLD)
+            {
+                auto const run = copyAsciiRun(src + i, n - i, dst + o);
+                i += run;
+                o += run;
+                asciiSeen = 0UL;
+            }
+        }
+        else
+        {
+            auto const decoded = decodeUtf(src + i, n - i);
+            i += decoded.length;
+            o += encodeUtf(decoded.codePoint, dst + o);
+            asciiSeen = 0UL;
+        }
+    }
+
+    return o;
+}
+
+/**
+ * @brief Transcode code units into a new string, sized by a counting pass, so that it is allocated exactly once.
+ *
+ * @tparam StringT_ std::basic_string<...> to transcode to
+ * @tparam FromCharT_ source char-type
+ * @param src the code units
+ * @param n number of code units
+ * @return StringT_ the transcoded string
+ */
+template <typename StringT_, typename FromCharT_> StringT_ transcoded(FromCharT_ const *src, std::size_t n)
+{
+    using to_char_type = typename StringT_::value_type;
+
+    StringT_ reval;
+    reval.resize_and_overwrite(transcodedLength<to_char_type>(src, n), [src, n](to_char_type *buffer, std::size_t) {
+        return transcode(src, n, buffer);
+    });
+
+    return reval;
+}
+} // namespace util::detail
+
+#endif // NS_UTIL_TRANSCODE_H_INCLUDED
@@ -0,0 +1,446 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/utf8.h
+ * Description: UTF-8 decoding, encoding and case mapping
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_UTF8_H_INCLUDED
+#define NS_UTIL_UTF8_H_INCLUDED
+
+#include "simd_kernels.h"
+#include "unicode_case_tables.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace util::detail
+{
+/**
+ * @brief A code point decoded from UTF-8 and the number of bytes it was encoded in.
+ */
+struct Utf8Decoded
+{
+    char32_t    codePoint; ///< the decoded code point
+    std::size_t length;    ///< number of bytes consumed, 0 if the bytes are not valid UTF-8
+};
+
+/**
+ * @brief Decode one code point from UTF-8. Overlong encodings, surrogates, code points above U+10FFFF and sequences
+ *        truncated by the end of the input are invalid.
+ *
+ * @param src the bytes, starting with the lead byte
+ * @param n number of bytes available, at least 1
+ * @return Utf8Decoded the code point and its length, the length being 0 for invalid bytes
+ */
+constexpr Utf8Decoded decodeUtf8(unsigned char const *src, std::size_t n)
+{
+    auto const lead = src[0];
+    if (lead < 0x80U)
+    {
+        return {lead, 1UL};
+    }
+
+    std::size_t length = 0UL;
+    char32_t    cp     = 0U;
+    char32_t    min    = 0U; // smallest code point that needs this length, to reject overlong encodings
+    if ((lead & 0xE0U) == 0xC0U)
+    {
+        length = 2UL;
+        cp     = lead & 0x1FU;
+        min    = 0x80U;
+    }
+    else if ((lead & 0xF0U) == 0xE0U)
+    {
+        length = 3UL;
+        cp     = lead & 0x0FU;
+        min    = 0x800U;
+    }
+    else if ((lead & 0xF8U) == 0xF0U)
+    {
+        length = 4UL;
+        cp     = lead & 0x07U;
+        min    = 0x1'0000U;
+    }
+    else
+    {
+        return {0U, 0UL};
+    }
+    if (length > n)
+    {
+        return {0U, 0UL};
+    }
+    for (std::size_t i = 1UL; i < length; ++i)
+    {
+        if ((src[i] & 0xC0U) != 0x80U)
+        {
+            return {0U, 0UL};
+        }
+        cp = (cp << 6U) | (src[i] & 0x3FU);
+    }
+    if (cp < min || cp > 0x10'FFFFU || (cp >= 0xD800U && cp <= 0xDFFFU))
+    {
+        return {0U, 0UL};
+    }
+
+    return {cp, length};
+}
+
+/**
+ * @brief Encode a code point as UTF-8.
+ *
+ * @param cp the code point, must be a valid Unicode scalar value
+ * @param dst destination, needs space for 4 bytes
+ * @return std::size_t number of bytes written
+ */
+constexpr std::size_t encodeUtf8(char32_t cp, unsigned char *dst)
+{
+    if (cp < 0x80U)
+    {
+        dst[0] = static_cast<unsigned char>(cp);
+        return 1UL;
+    }
+    if (cp < 0x800U)
+    {
+        dst[0] = static_cast<unsigned char>(0xC0U | (cp >> 6U));
+        dst[1] = static_cast<unsigned char>(0x80U | (cp & 0x3FU));
+        return 2UL;
+    }
+    if (cp < 0x1'0000U)
+    {
+        dst[0] = static_cast<unsigned char>(0xE0U | (cp >> 12U));
+        dst[1] = static_cast<unsigned char>(0x80U | ((cp >> 6U) & 0x3FU));
+        dst[2] = static_cast<unsigned char>(0x80U | (cp & 0x3FU));
+        return 3UL;
+    }
+    dst[0] = static_cast<unsigned char>(0xF0U | (cp >> 18U));
+    dst[1] = static_cast<unsigned char>(0x80U | ((cp >> 12U) & 0x3FU));
+    dst[2] = static_cast<unsigned char>(0x80U | ((cp >> 6U) & 0x3FU));
+    dst[3] = static_cast<unsigned char>(0x80U | (cp & 0x3FU));
+
+    return 4UL;
+}
+
+/**
+ * @brief Check whether a byte is a UTF-8 continuation byte (10xxxxxx).
+ *
+ * @param b the byte
+ * @return true, if b is a continuation byte, false otherwise
+ */
+constexpr bool isUtf8Continuation(unsigned char b)
+{
+    return (b & 0xC0U) == 0x80U;
+}
+
+/**
+ * @brief Length of the longest prefix of src that consists of complete, valid UTF-8 characters, which is the
+ *        position of the first byte of the first invalid (or truncated) sequence. Blocks are checked by the
+ *        vectorised Utf8Checker, testing for errors once per group of blocks; only the group with the first
+ *        error, and the tail, are decoded character by character to find the exact position.
+ *
+ * @param src the bytes
+ * @param n number of bytes
+ * @return std::size_t the length of the valid prefix, n if all bytes are valid UTF-8
+ */
+inline std::size_t utf8ValidPrefixLength(unsigned char const *src, std::size_t n)
+{
+    std::size_t i = 0UL;
+#if defined(__SSSE3__)
+    constexpr auto BLOCK_SIZE = Utf8Checker::BLOCK_SIZE;
+    constexpr auto GROUP_SIZE = Utf8Checker::GROUP_SIZE;
+    Utf8Checker    checker;
+    while (i + GROUP_SIZE <= n)
+    {
+        checker.checkGroup(src + i);
+        if (checker.hasError())
+        {
+            break;
+        }
+        i += GROUP_SIZE;
+    }
+    while (!checker.hasError() && i + BLOCK_SIZE <= n)
+    {
+        checker.check(src + i);
+        if (!checker.hasError())
+        {
+            i += BLOCK_SIZE;
+        }
+    }
+    // the bytes before i are valid, except that they may end inside a sequence, which is decoded again from its lead
+    auto const checked = i;
+    while (i > 0UL && checked - i < 3UL && isUtf8Continuation(src[i - 1UL]))
+    {
+        --i;
+    }
+    if (i > 0UL && src[i - 1UL] >= 0xC0U)
+    {
+        --i;
+    }
+#endif
+    while (i < n)
+    {
+        if (isAsciiChar(src[i]))
+        {
+            ++i;
+            continue;
+        }
+        auto const length = decodeUtf8(src + i, n - i).length;
+        if (length == 0UL)
+        {
+            return i;
+        }
+        i += length;
+    }
+
+    return n;
+}
+
+/**
+ * @brief Length of the prefix of src that ends before a multi-byte sequence that is cut short by the end of the bytes,
+ *        but may still be completed by the bytes that follow. Invalid bytes are left to the validation.
+ *
+ * @param src the bytes
+ * @param n number of bytes
+ * @return std::size_t n, or the position of the lead byte of the incomplete sequence at the end
+ */
+constexpr std::size_t utf8CompletePrefixLength(unsigned char const *src, std::size_t n)
+{
+    for (std::size_t back = 1UL; back <= std::min(n, 3UL); ++back)
+    {
+        auto const b = src[n - back];
+        if (!isUtf8Continuation(b))
+        {
+            auto const length = b >= 0xF0U ? 4UL : b >= 0xE0U ? 3UL : b >= 0xC0U ? 2UL : 1UL;
+            return length > back ? n - back : n;
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief End of the code points encoded in at most two bytes of UTF-8.
+ */
+inline constexpr char32_t TWO_BYTE_END = 0x800U;
+
+/**
+ * @brief Direct table of the case mapping deltas of the code points below TWO_BYTE_END (Latin, Greek, Cyrillic,
+ *        Armenian, Hebrew and Arabic), expanded from the ranges at compile-time, so that the most frequent non-ASCII
+ *        characters are mapped without a search.
+ *
+ * @tparam Case_ target case
+ */
+template <LetterCase Case_>
+inline constexpr auto TWO_BYTE_CASE_DELTAS = [] {
+    // int32_t, as some deltas exceed 16 bits (e.g. ɥ U+0265 maps to Ɥ U+A78D)
+    std::array<int32_t, TWO_BYTE_END> reval{};
+    for (auto const &range: Case_ == LetterCase::LOWER ? std::span<CaseRange const>{LOWER_CASE_RANGES}
+                                                       : std::span<CaseRange const>{UPPER_CASE_RANGES})
+    {
+        for (char32_t cp = range.first; cp <= range.last && cp < TWO_BYTE_END; cp += range.stride)
+        {
+            reval[cp] = range.delta;
+        }
+    }
+
+    return reval;
+}();
+
+/**
+ * @brief Map a code point with the simple (one-to-one) Unicode case mapping, looked up by binary search in the
+ *        generated ranges of unicode_case_tables.h.
+ *
+ * @tparam Case_ target case
+ * @param cp the code point
+ * @return char32_t the mapped code point, cp itself if it has no mapping
+ */
+template <LetterCase Case_> constexpr char32_t simpleCaseOf(char32_t cp)
+{
+    if (cp < TWO_BYTE_END)
+    {
+        return static_cast<char32_t>(static_cast<int32_t>(cp) + TWO_BYTE_CASE_DELTAS<Case_>[cp]);
+    }
+    std::span<CaseRange const> const ranges =
+        Case_ == LetterCase::LOWER ? std::span<CaseRange const>{LOWER_CASE_RANGES} : UPPER_CASE_RANGES;
+
+    auto const found = std::ranges::lower_bound(ranges, cp, {}, &CaseRange::last);
+    if (found == std::end(ranges) || cp < found->first || (cp - found->first) % found->stride != 0U)
+    {
+        return cp;
+    }
+
+    return static_cast<char32_t>(static_cast<int32_t>(cp) + found->delta);
+}
+
+/**
+ * @brief Upper bound of the number of bytes n bytes of UTF-8 occupy after case mapping: no simple case mapping
+ *        grows a code point by more than half of its length (2-byte characters mapping to 3 bytes being the worst).
+ *
+ * @param n number of bytes
+ * @return std::size_t capacity needed for the mapped bytes
+ */
+constexpr std::size_t utf8CaseMappedCapacity(std::size_t n)
+{
+    return n + n / 2UL;
+}
+
+/**
+ * @brief Case-map the character at position i of src, and move i past it. A byte that is not valid UTF-8 is copied.
+ *
+ * @tparam Case_ target case
+ * @param src the UTF-8 bytes
+ * @param n number of bytes
+ * @param i position of the character, moved past it
+ * @param dst destination, needs space for 4 bytes
+ * @return std::size_t number of bytes written
+ */
+template <LetterCase Case_>
+std::size_t utf8ConvertCharacter(unsigned char const *src, std::size_t n, std::size_t &i, unsigned char *dst)
+{
+    if (isAsciiChar(src[i]))
+    {
+        dst[0] = asciiCaseChar<Case_>(src[i++]);
+        return 1UL;
+    }
+    auto const decoded = decodeUtf8(src + i, n - i);
+    if (decoded.length == 0UL)
+    {
+        dst[0] = src[i++];
+        return 1UL;
+    }
+    i += decoded.length;
+
+    return encodeUtf8(simpleCaseOf<Case_>(decoded.codePoint), dst);
+}
+
+/**
+ * @brief Case-map UTF-8 from src to dst. The ASCII letters of every block are converted with SIMD, and only the
+ *        non-ASCII characters of the block are decoded, mapped with simpleCaseOf and re-encoded over their original
+ *        bytes. Where a character changes its encoded length, the next block starts after that character.
+ *        Bytes that are not valid UTF-8 are copied unchanged.
+ *
+ * @tparam Case_ target case
+ * @param src the UTF-8 bytes
+ * @param n number of bytes
+ * @param dst destination, needs utf8CaseMappedCapacity(n) bytes, must not overlap src
+ * @return std::size_t number of bytes written
+ */
+template <LetterCase Case_> std::size_t utf8ConvertCase(unsigned char const *src, std::size_t n, unsigned char *dst)
+{
+    std::size_t i = 0UL;
+    std::size_t o = 0UL;
+    while (i + SIMD_BLOCK_SIZE <= n)
+    {
+        // convert the ASCII letters of the whole block, then re-map its non-ASCII characters where they are
+        auto       nonAscii = asciiLetterCaseBlock<Case_>(src + i, dst + o);
+        auto const start    = i;
+        i += SIMD_BLOCK_SIZE;
+        while (nonAscii != 0ULL)
+        {
+            auto const at      = start + static_cast<std::size_t>(std::countr_zero(nonAscii));
+            auto const decoded = decodeUtf8(src + at, n - at);
+            auto const length  = decoded.length == 0UL ? 1UL : decoded.length;
+            if (decoded.length != 0UL)
+            {
+                unsigned char encoded[4];
+                auto const    encodedLength = encodeUtf8(simpleCaseOf<Case_>(decoded.codePoint), encoded);
+                if (encodedLength != length)
+                {
+                    // the rest of the block shifts, so the next block starts after this character
+                    i = at;
+                    break;
+                }
+                std::memcpy(dst + o + (at - start), encoded, length);
+            }
+            auto const consumed = at + length - start;
+            if (consumed >= SIMD_BLOCK_SIZE)
+            {
+                // the character reaches into the next block, which starts after it
+                i = at + length;
+                break;
+            }
+            nonAscii &= ~0ULL << consumed;
+        }
+        o += i - start;
+        if (i - start < SIMD_BLOCK_SIZE)
+        {
+            o += utf8ConvertCharacter<Case_>(src, n, i, dst + o);
+        }
+    }
+    while (i < n)
+    {
+        if (isAsciiChar(src[i]))
+        {
+            dst[o++] = asciiCaseChar<Case_>(src[i++]);
+        }
+        else
+        {
+            o += utf8ConvertCharacter<Case_>(src, n, i, dst + o);
+        }
+    }
+
+    return o;
+}
+
+/**
+ * @brief Case-map a UTF-8 encoded string in place. The leading ASCII part is converted in the string's own buffer;
+ *        only from the first non-ASCII character on, the rest is mapped into a new buffer, as it may change length.
+ *
+ * @tparam Case_ target case
+ * @tparam StringT_ string-type, must be std::basic_string<...> of a byte-sized char-type
+ * @param str the string to convert
+ */
+template <LetterCase Case_, typename StringT_> void utf8ConvertCaseInPlace(StringT_ &str)
+{
+    auto *const bytes = reinterpret_cast<unsigned char *>(std::data(str));
+    auto const  n     = std::size(str);
+    std::size_t i     = 0UL;
+    while (i + SIMD_BLOCK_SIZE <= n && asciiCaseBlock<Case_>(bytes + i, bytes + i))
+    {
+        i += SIMD_BLOCK_SIZE;
+    }
+    while (i < n && isAsciiChar(bytes[i]))
+    {
+        bytes[i] = asciiCaseChar<Case_>(bytes[i]);
+        ++i;
+    }
+    if (i == n)
+    {
+        return;
+    }
+
+    StringT_ mapped{str.get_allocator()};
+    mapped.resize_and_overwrite(i + utf8CaseMappedCapacity(n - i), [&](auto *buffer, std::size_t) {
+        auto *const out = reinterpret_cast<unsigned char *>(buffer);
+        std::memcpy(out, bytes, i);
+
+        return i + utf8ConvertCase<Case_>(bytes + i, n - i, out + i);
+    });
+    str.swap(mapped);
+}
+} // namespace util::detail
+
+#endif // NS_UTIL_UTF8_H_INCLUDED
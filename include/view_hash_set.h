@@ -0,0 +1,239 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/view_hash_set.h
+ * Description: open-addressing hash set of string-views for fast membership tests on split tokens
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_VIEW_HASH_SET_H_INCLUDED
+#define NS_UTIL_VIEW_HASH_SET_H_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace util
+{
+namespace detail
+{
+/**
+ * @brief Check whether views with the traits TraitsT_ can be hashed consistently with TraitsT_::eq: this is the case
+ *        for std::char_traits, and for traits that fold the case with a static toUpperChar(), like ci_char_traits.
+ */
+template <typename CharT_, typename TraitsT_>
+inline constexpr bool is_hashable_traits_v =
+    std::is_same_v<TraitsT_, std::char_traits<CharT_>> || requires(CharT_ c) { TraitsT_::toUpperChar(c); };
+
+/**
+ * @brief Hash a string-view consistently with the equality of its traits.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits
+ * @param view the view to hash
+ * @return std::size_t the hash value
+ */
+template <typename CharT_, typename TraitsT_>
+std::size_t hashView(std::basic_string_view<CharT_, TraitsT_> view)
+requires(is_hashable_traits_v<CharT_, TraitsT_>)
+{
+    if constexpr (std::is_same_v<TraitsT_, std::char_traits<CharT_>>)
+    {
+        return std::hash<std::basic_string_view<CharT_, TraitsT_>>{}(view);
+    }
+    else
+    {
+        // FNV-1a over the case-folded characters
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        for (auto c: view)
+        {
+            auto const folded = TraitsT_::toUpperChar(c);
+            hash ^= static_cast<uint64_t>(static_cast<std::make_unsigned_t<decltype(folded)>>(folded));
+            hash *= 0x100000001B3ULL;
+        }
+
+        return static_cast<std::size_t>(hash);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief Open-addressing (linear probing) hash set of string-views.
+ *        All views live in one flat array, so building the set costs no allocation per token and a membership test
+ *        touches one or two adjacent slots instead of chasing the pointers of a node-based std::set.
+ *        The set does not own the characters: the strings the views point into must outlive it.
+ *        Views are compared with their traits, so sets of case-insensitive views ignore the case.
+ *
+ * @tparam CharT_ char-type
+ * @tparam TraitsT_ char-traits, must be std::char_traits or provide toUpperChar(), like ci_char_traits
+ */
+template <typename CharT_, typename TraitsT_ = std::char_traits<CharT_>>
+requires(detail::is_hashable_traits_v<CharT_, TraitsT_>)
+class ViewHashSet
+{
+  public:
+    using view_type = std::basic_string_view<CharT_, TraitsT_>;
+
+    /**
+     * @brief Construct an empty set.
+     */
+    ViewHashSet() = default;
+
+    /**
+     * @brief Make room for expectedSize views without re-hashing.
+     *
+     * @param expectedSize number of views expected
+     */
+    void reserve(std::size_t expectedSize)
+    {
+        // keep the load factor at or below 1/2, so that probe sequences stay short
+        auto const capacity = std::bit_ceil(std::max(MIN_CAPACITY, 2UL * expectedSize));
+        if (capacity > std::size(slots_))
+        {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * @brief Add a view, unless an equal view is already in the set.
+     *
+     * @param token the view to add
+     * @return true, if the view has been added, false if an equal view was already present
+     */
+    bool insert(view_type token)
+    {
+        if (2UL * (size_ + 1UL) > std::size(slots_))
+        {
+            rehash(std::max(MIN_CAPACITY, 2UL * std::size(slots_)));
+        }
+        auto const hash = slotHash(token);
+        auto       slot = findSlot(token, hash);
+        if (slots_[slot].hash != EMPTY)
+        {
+            return false;
+        }
+        slots_[slot] = Slot{token, hash};
+        size_++;
+
+        return true;
+    }
+
+    /**
+     * @brief Check whether an equal view is in the set.
+     *
+     * @param token the view to look for
+     * @return true, if so, false otherwise
+     */
+    [[nodiscard]] bool contains(view_type token) const
+    {
+        return size_ > 0UL && slots_[findSlot(token, slotHash(token))].hash != EMPTY;
+    }
+
+    /**
+     * @brief Number of views in the set.
+     *
+     * @return std::size_t the count
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Check whether the set is empty.
+     *
+     * @return true, if so, false otherwise
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0UL;
+    }
+
+    /**
+     * @brief The views in the set, in no particular order.
+     *
+     * @return a range of view_type
+     */
+    [[nodiscard]] auto values() const
+    {
+        return slots_ | std::views::filter([](Slot const &slot) { return slot.hash != EMPTY; })
+               | std::views::transform([](Slot const &slot) { return slot.token; });
+    }
+
+  private:
+    static constexpr std::size_t MIN_CAPACITY = 16UL;
+    static constexpr std::size_t EMPTY        = 0UL;
+
+    struct Slot
+    {
+        view_type   token;
+        std::size_t hash = EMPTY;
+    };
+
+    /**
+     * @brief The hash of a view, with the lowest bit forced on so that it never equals EMPTY.
+     */
+    static std::size_t slotHash(view_type token)
+    {
+        return detail::hashView(token) | 1UL;
+    }
+
+    /**
+     * @brief Find the slot holding a view equal to token, or the empty slot where it would be inserted.
+     */
+    std::size_t findSlot(view_type token, std::size_t hash) const
+    {
+        auto const mask = std::size(slots_) - 1UL;
+        // the lowest bit of hash is always set, so it is dropped for the start of the probe sequence
+        auto slot = (hash >> 1U) & mask;
+        while (slots_[slot].hash != EMPTY && (slots_[slot].hash != hash || slots_[slot].token != token))
+        {
+            slot = (slot + 1UL) & mask;
+        }
+
+        return slot;
+    }
+
+    void rehash(std::size_t capacity)
+    {
+        auto old = std::vector<Slot>(capacity);
+        old.swap(slots_);
+        for (auto const &slot: old)
+        {
+            if (slot.hash != EMPTY)
+            {
+                slots_[findSlot(slot.token, slot.hash)] = slot;
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t       size_ = 0UL;
+};
+} // namespace util
+
+#endif // NS_UTIL_VIEW_HASH_SET_H_INCLUDED
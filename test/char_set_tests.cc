@@ -0,0 +1,142 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/char_set_tests.cc
+ * Description: Unit tests for compile-time character sets.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "char_set.h"
+#include "ci_string.h"
+#include "stringutil.h"
+
+#include <cctype>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+using namespace util;
+
+class CharSetTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(CharSetTest, compile_time_construction)
+{
+    constexpr CharSet separators{",;|"};
+    static_assert(separators.contains(','));
+    static_assert(separators.contains(';'));
+    static_assert(!separators.contains('.'));
+    static_assert(separators.size() == 3UL);
+    static_assert(CharSet{}.empty());
+
+    constexpr CharSet wide{L"€£¥ "};
+    static_assert(wide.contains(L'€'));
+    static_assert(wide.contains(U'£'));
+    static_assert(wide.contains(' '));
+    static_assert(!wide.contains(L'$'));
+    static_assert(wide.size() == 4UL);
+}
+
+TEST_F(CharSetTest, predefined_classes_match_c_locale)
+{
+    for (int c = 0; c < 256; c++)
+    {
+        ASSERT_EQ(CharClass::WHITESPACE.contains(static_cast<unsigned char>(c)), isspace(c) != 0) << c;
+        ASSERT_EQ(CharClass::BLANK.contains(static_cast<unsigned char>(c)), isblank(c) != 0) << c;
+        ASSERT_EQ(CharClass::DIGIT.contains(static_cast<unsigned char>(c)), isdigit(c) != 0) << c;
+        ASSERT_EQ(CharClass::XDIGIT.contains(static_cast<unsigned char>(c)), isxdigit(c) != 0) << c;
+        ASSERT_EQ(CharClass::LOWER.contains(static_cast<unsigned char>(c)), islower(c) != 0) << c;
+        ASSERT_EQ(CharClass::UPPER.contains(static_cast<unsigned char>(c)), isupper(c) != 0) << c;
+        ASSERT_EQ(CharClass::ALPHA.contains(static_cast<unsigned char>(c)), isalpha(c) != 0) << c;
+        ASSERT_EQ(CharClass::ALNUM.contains(static_cast<unsigned char>(c)), isalnum(c) != 0) << c;
+        ASSERT_EQ(CharClass::PUNCT.contains(static_cast<unsigned char>(c)), ispunct(c) != 0) << c;
+    }
+}
+
+TEST_F(CharSetTest, runtime_construction_and_wide_table)
+{
+    CharSet fromString{string{"abc"}};
+    ASSERT_TRUE(fromString.contains('b'));
+    ASSERT_FALSE(fromString.contains('B'));
+
+    CharSet manyWide;
+    for (char32_t c = 0x4E00; c < 0x4E00 + CharSet::MAX_WIDE; c++)
+    {
+        manyWide.insert(c);
+    }
+    ASSERT_EQ(manyWide.size(), CharSet::MAX_WIDE);
+    for (char32_t c = 0x4E00; c < 0x4E00 + CharSet::MAX_WIDE; c++)
+    {
+        ASSERT_TRUE(manyWide.contains(c));
+    }
+    ASSERT_FALSE(manyWide.contains(U'\x4DFF'));
+    manyWide.insert(U'\x4E00'); // already in the set
+    ASSERT_THROW(manyWide.insert(U'\x9FFF'), std::length_error);
+}
+
+TEST_F(CharSetTest, strip_trim_replace_with_char_sets)
+{
+    string padded{" \t 42, 43 \n"};
+    trim(padded);
+    ASSERT_EQ(padded, "42, 43");
+    strip(padded, CharClass::PUNCT | CharSet{" "});
+    ASSERT_EQ(padded, "4243");
+
+    string digits{"0012300"};
+    trimLeft(digits, CharSet{"0"});
+    ASSERT_EQ(digits, "12300");
+    trimRight(digits, CharSet{"0"});
+    ASSERT_EQ(digits, "123");
+
+    wstring wide{L"€€price€€"};
+    strip(wide, CharSet{L"€"});
+    ASSERT_EQ(wide, L"price");
+
+    string record{"\tname;value\r\n"};
+    replaceChar(record, CharClass::WHITESPACE, '_', StripTrimMode::ALL);
+    ASSERT_EQ(record, "_name;value__");
+    replaceChar(record, CharSet{";"}, ',');
+    ASSERT_EQ(record, "_name,value__");
+    replaceCharLeft(record, CharSet{"_"}, '<');
+    ASSERT_EQ(record, "<name,value__");
+    replaceCharRight(record, CharSet{"_"}, '>');
+    ASSERT_EQ(record, "<name,value>>");
+
+    // membership of a CharSet is exact, also for case-insensitive strings
+    ci_string ci{"aAbBaA"};
+    strip(ci, CharSet{"a"});
+    ASSERT_EQ(util::convert<string>(ci), "AbBA");
+
+    // directional replacement through replaceCharRight with a plain string
+    string right{"  a b  "};
+    replaceCharRight(right, " ", '_');
+    ASSERT_EQ(right, "  a b__");
+}
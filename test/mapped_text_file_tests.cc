@@ -0,0 +1,145 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/mapped_text_file_tests.cc
+ * Description: Unit tests for the memory-mapped text file.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "mapped_text_file.h"
+#include "stringutil.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class MappedTextFileTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        path_ = filesystem::temp_directory_path() / "mapped_text_file_test.txt";
+    }
+
+    void TearDown() override
+    {
+        filesystem::remove(path_);
+    }
+
+    void writeFile(string const &contents) const
+    {
+        ofstream out{path_, ios::binary};
+        out << contents;
+    }
+
+    filesystem::path path_;
+};
+
+TEST_F(MappedTextFileTest, util_mapped_text_file_lines_test)
+{
+    string const contents = "first line\n  second line  \n\nlast,line,with,fields\n";
+    writeFile(contents);
+    MappedTextFile const file{path_};
+
+    ASSERT_EQ(file.size(), contents.size());
+    ASSERT_EQ(file.view(), contents);
+
+    vector<string> lines;
+    for (auto line: file.lines())
+    {
+        lines.emplace_back(line);
+    }
+    ASSERT_EQ(lines, splitIntoVector(contents, '\n'));
+
+    // trimming and stripping are view operations on the lines, the views point into the mapping
+    auto line = *next(file.lines().begin());
+    ASSERT_EQ(trimmedView(line), "second line");
+    ASSERT_EQ(strippedView(trimmedView(line), "sn"), "econd line");
+    ASSERT_GE(trimmedView(line).data(), file.view().data());
+    ASSERT_LT(trimmedView(line).data(), file.view().data() + file.size());
+
+    vector<vector<string>> fields;
+    for (auto fieldsOfLine: file.fields(','))
+    {
+        fields.emplace_back();
+        for (auto field: fieldsOfLine)
+        {
+            fields.back().emplace_back(field);
+        }
+    }
+    ASSERT_EQ(fields.size(), 5UL);
+    ASSERT_EQ(fields[0], (vector<string>{"first line"}));
+    ASSERT_EQ(fields[2], (vector<string>{""}));
+    ASSERT_EQ(fields[3], splitIntoVector(string{"last,line,with,fields"}, ','));
+    ASSERT_EQ(fields[4], (vector<string>{""}));
+}
+
+TEST_F(MappedTextFileTest, util_mapped_text_file_separators_test)
+{
+    string const contents = "a::b\r\n::c\r\nd";
+    writeFile(contents);
+    MappedTextFile file{path_};
+
+    vector<string> lines;
+    for (auto line: file.lines("\r\n"))
+    {
+        lines.emplace_back(line);
+    }
+    ASSERT_EQ(lines, splitIntoVector(contents, "\r\n"));
+
+    vector<string> fields;
+    for (auto fieldsOfLine: file.fields(string{"::"}, "\r\n"))
+    {
+        for (auto field: fieldsOfLine)
+        {
+            fields.emplace_back(field);
+        }
+    }
+    ASSERT_EQ(fields, (vector<string>{"a", "b", "", "c", "d"}));
+
+    // rows of a multi-character separator stay valid while the range lives, also after it has been moved
+    auto       range      = file.fields(string{"::"}, "\r\n");
+    auto const firstRow   = *range.begin();
+    auto       movedRange = std::move(range);
+    ASSERT_EQ(vector<string>(firstRow.begin(), firstRow.end()), (vector<string>{"a", "b"}));
+    ASSERT_EQ(std::ranges::distance(movedRange), 3);
+
+    // moving hands the mapping on
+    MappedTextFile moved{std::move(file)};
+    ASSERT_EQ(moved.view(), contents);
+    ASSERT_TRUE(file.view().empty());
+}
+
+TEST_F(MappedTextFileTest, util_mapped_text_file_empty_and_missing_test)
+{
+    writeFile("");
+    MappedTextFile const file{path_};
+    ASSERT_EQ(file.size(), 0UL);
+    ASSERT_TRUE(file.view().empty());
+    ASSERT_EQ(std::ranges::distance(file.lines()), 1L);
+
+    ASSERT_THROW(MappedTextFile{path_.string() + ".does-not-exist"}, system_error);
+}
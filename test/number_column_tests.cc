@@ -0,0 +1,169 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/number_column_tests.cc
+ * Description: Unit tests for inferring the number class of columns.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "number_column.h"
+#include "stringutil.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class NumberColumnTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    static vector<string_view> viewsOf(vector<string> const &strings)
+    {
+        return vector<string_view>(strings.begin(), strings.end());
+    }
+};
+
+/**
+ * @brief Executor running the tasks one after the other, counting them.
+ */
+struct CountingExecutor
+{
+    size_t               concurrency_;
+    atomic<size_t> mutable tasks = 0UL;
+
+    [[nodiscard]] size_t concurrency() const
+    {
+        return concurrency_;
+    }
+
+    template <typename Func_> void bulk(size_t n, Func_ &&task) const
+    {
+        for (size_t index = 0UL; index < n; index++)
+        {
+            task(index);
+            tasks++;
+        }
+    }
+};
+
+TEST_F(NumberColumnTest, cells_match_classify_number_string)
+{
+    vector<string> const cells{
+        "0",
+        "-0",
+        "+7",
+        "-42",
+        "123456789012345678",
+        "1234567890123456789",
+        "-9223372036854775808",
+        "9223372036854775808",
+        "18446744073709551615",
+        "18446744073709551616",
+        "3.14",
+        "-.5",
+        "5.",
+        "0.000000000000000000000000000000000001",
+        "1e10",
+        "-2.5E-3",
+        "",
+        "+",
+        "-",
+        ".",
+        "-.",
+        "1.2.3",
+        "12a",
+        "1 ",
+        "0x10",
+        "inf",
+        "1:2",
+        "12345678/",
+        "1e999",
+        string(299UL, '9') + ".5",
+        string(400UL, '9') + ".5",
+    };
+    auto const views  = viewsOf(cells);
+    auto const column = classifyNumberColumn(views);
+    ASSERT_EQ(column.cells.size(), cells.size());
+    for (size_t index = 0UL; index < cells.size(); index++)
+    {
+        ASSERT_EQ(column.cells[index], classifyNumberString(cells[index])) << "'" << cells[index] << "'";
+    }
+    ASSERT_EQ(column.widest, NumberClass::NONE);
+}
+
+TEST_F(NumberColumnTest, widest_class)
+{
+    auto const widest = [](vector<string> const &cells) {
+        auto const views = viewsOf(cells);
+        return classifyNumberColumn(views).widest;
+    };
+
+    ASSERT_EQ(widest({}), NumberClass::NONE);
+    ASSERT_EQ(widest({"1", "-2", "+3"}), NumberClass::INT);
+    ASSERT_EQ(widest({"1", "18446744073709551615"}), NumberClass::UINT);
+    ASSERT_EQ(widest({"-0", "18446744073709551615"}), NumberClass::UINT);
+    ASSERT_EQ(widest({"-1", "18446744073709551615"}), NumberClass::FLOAT);
+    ASSERT_EQ(widest({"1", "2.5"}), NumberClass::FLOAT);
+    ASSERT_EQ(widest({"1", "2.5", "n/a"}), NumberClass::NONE);
+}
+
+TEST_F(NumberColumnTest, parallel_matches_serial)
+{
+    mt19937                                gen{42U};
+    uniform_int_distribution<int64_t>      ints{-1'000'000L, 1'000'000L};
+    uniform_real_distribution<double>      reals{-1.0e3, 1.0e3};
+    vector<string>                         cells;
+    for (size_t index = 0UL; index < 100'000UL; index++)
+    {
+        cells.push_back(index % 3UL == 0UL ? to_string(reals(gen)) : to_string(ints(gen)));
+    }
+    auto const views  = viewsOf(cells);
+    auto const serial = classifyNumberColumn(views);
+    ASSERT_EQ(serial.widest, NumberClass::FLOAT);
+
+    for (size_t threads: {2UL, 3UL, 8UL})
+    {
+        auto const parallel = classifyNumberColumn(views, threads);
+        ASSERT_EQ(parallel.widest, serial.widest) << "threads=" << threads;
+        ASSERT_EQ(parallel.cells, serial.cells) << "threads=" << threads;
+    }
+
+    // small columns are not worth more than one task
+    CountingExecutor executor{8UL};
+    ASSERT_EQ(classifyNumberColumn(span{views}.first(100UL), executor).cells.size(), 100UL);
+    ASSERT_EQ(executor.tasks, 1UL);
+    executor.tasks = 0UL;
+    ASSERT_EQ(classifyNumberColumn(views, executor).cells, serial.cells);
+    ASSERT_EQ(executor.tasks, 6UL);
+}
@@ -0,0 +1,152 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/parallel_split_tests.cc
+ * Description: Unit tests for splitting large buffers on several threads.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "parallel_split.h"
+#include "stringutil.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class ParallelSplitTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    /**
+     * @brief A buffer large enough for several chunks, with runs of separators (empty fields) everywhere.
+     */
+    static string makeBuffer(size_t size, string_view alphabet, unsigned seed = 42U)
+    {
+        mt19937                            gen{seed};
+        uniform_int_distribution<size_t>   dist{0UL, alphabet.size() - 1UL};
+        string                             buffer(size, ' ');
+        for (auto &c: buffer)
+        {
+            c = alphabet[dist(gen)];
+        }
+
+        return buffer;
+    }
+
+    template <typename TokenT_, typename StringT_>
+    static vector<StringT_> owned(vector<TokenT_> const &tokens)
+    {
+        vector<StringT_> reval;
+        for (auto const &token: tokens)
+        {
+            reval.emplace_back(token);
+        }
+
+        return reval;
+    }
+};
+
+/**
+ * @brief Executor running the tasks one after the other, counting them.
+ */
+struct SerialExecutor
+{
+    size_t               concurrency_;
+    atomic<size_t> mutable tasks = 0UL;
+
+    [[nodiscard]] size_t concurrency() const
+    {
+        return concurrency_;
+    }
+
+    template <typename Func_> void bulk(size_t n, Func_ &&task) const
+    {
+        for (size_t index = 0UL; index < n; index++)
+        {
+            task(index);
+            tasks++;
+        }
+    }
+};
+
+TEST_F(ParallelSplitTest, matches_serial_split)
+{
+    auto const buffer = makeBuffer(3UL * 1'024UL * 1'024UL, "abc,,,");
+    auto const serial = splitIntoVector(buffer, ',');
+
+    for (size_t threads: {1UL, 2UL, 3UL, 8UL})
+    {
+        auto const views = parallelSplit(buffer, ',', threads);
+        ASSERT_EQ(views.size(), serial.size()) << "threads=" << threads;
+        ASSERT_EQ((owned<string_view, string>(views)), serial) << "threads=" << threads;
+        ASSERT_EQ(views.front().data(), buffer.data());
+    }
+
+    auto const strings = parallelSplit<string>(buffer, ',', 4UL);
+    ASSERT_EQ(strings, serial);
+
+    // leading and trailing separators, and a buffer without any
+    auto const framed = "," + buffer + ",";
+    ASSERT_EQ((owned<string_view, string>(parallelSplit(framed, ',', 4UL))), splitIntoVector(framed, ','));
+    auto const plain = string(1'024UL * 1'024UL, 'x');
+    ASSERT_EQ(parallelSplit(plain, ',', 4UL).size(), 1UL);
+    ASSERT_EQ(parallelSplit(string_view{}, ',', 4UL), (vector<string_view>{""}));
+}
+
+TEST_F(ParallelSplitTest, string_separators)
+{
+    auto const buffer = makeBuffer(2UL * 1'024UL * 1'024UL, "ab::");
+    ASSERT_EQ((owned<string_view, string>(parallelSplit(buffer, "::", 4UL))), splitIntoVector(buffer, "::"));
+    ASSERT_EQ((owned<string_view, string>(parallelSplit(buffer, "b:", 4UL))), splitIntoVector(buffer, "b:"));
+
+    // occurrences of "aa" can overlap, so the chunks could not be cut independently: this stays serial
+    auto const runs = makeBuffer(2UL * 1'024UL * 1'024UL, "aab");
+    ASSERT_EQ((owned<string_view, string>(parallelSplit(runs, "aa", 4UL))), splitIntoVector(runs, "aa"));
+    ASSERT_EQ((owned<string_view, string>(parallelSplit(runs, "aba", 4UL))), splitIntoVector(runs, "aba"));
+}
+
+TEST_F(ParallelSplitTest, custom_executor_and_traits)
+{
+    auto const     buffer = makeBuffer(2UL * 1'024UL * 1'024UL, "xyzXYZ;");
+    SerialExecutor executor{4UL};
+    auto const     tokens = parallelSplit(buffer, ';', executor);
+    ASSERT_EQ((owned<string_view, string>(tokens)), splitIntoVector(buffer, ';'));
+    // a counting and a tokenising task per chunk
+    ASSERT_EQ(executor.tasks, 8UL);
+
+    ci_string const ciBuffer{buffer.begin(), buffer.end()};
+    auto const      ciTokens = parallelSplit<ci_string>(ciBuffer, 'x', 3UL);
+    ASSERT_EQ(ciTokens, splitIntoVector(ciBuffer, 'x'));
+}
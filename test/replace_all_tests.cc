@@ -0,0 +1,167 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/replace_all_tests.cc
+ * Description: Unit tests for replacing several substrings at once.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "replace_all.h"
+#include "test_strings.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class ReplaceAllTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    /**
+     * @brief Leftmost-longest replacement, trying every pattern at every position.
+     */
+    static string naiveReplaceAll(string const &str, vector<pair<string_view, string_view>> const &replacements)
+    {
+        string reval;
+        size_t pos = 0UL;
+        while (pos < str.size())
+        {
+            size_t best = replacements.size();
+            for (size_t i = 0UL; i < replacements.size(); i++)
+            {
+                auto const &from = replacements[i].first;
+                if (str.compare(pos, from.size(), from) == 0
+                    && (best == replacements.size() || from.size() >= replacements[best].first.size()))
+                {
+                    best = i;
+                }
+            }
+            if (best == replacements.size())
+            {
+                reval += str[pos++];
+            }
+            else
+            {
+                reval += replacements[best].second;
+                pos += replacements[best].first.size();
+            }
+        }
+
+        return reval;
+    }
+};
+
+TEST_F(ReplaceAllTest, util_replace_all_test)
+{
+    string html = "if (a < b && c > d) return \"<tag>\";";
+    replaceAll(html, {{"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"}, {"\"", "&quot;"}});
+    ASSERT_EQ(html, "if (a &lt; b &amp;&amp; c &gt; d) return &quot;&lt;tag&gt;&quot;;");
+
+    // leftmost-longest, no replacement is rescanned, the last duplicate counts
+    string text = "she sells sea shells";
+    replaceAll(text, {{"he", "HE"}, {"she", "x"}, {"shells", "shellfish"}, {"s", "5"}, {"sea", "ocean"}, {"s", "S"}});
+    ASSERT_EQ(text, "x SellS ocean shellfish");
+
+    string swapped = "ab ba";
+    replaceAll(swapped, {{"a", "b"}, {"b", "a"}});
+    ASSERT_EQ(swapped, "ba ab");
+
+    // a short pattern inside a long, failing one is found
+    string prefix = "abcX";
+    replaceAll(prefix, {{"abcdef", "1"}, {"ab", "2"}, {"c", "3"}});
+    ASSERT_EQ(prefix, "23X");
+
+    string noMatch = "nothing to see";
+    auto const *const data = noMatch.data();
+    replaceAll(noMatch, {{"xyz", ""}});
+    ASSERT_EQ(noMatch, "nothing to see");
+    ASSERT_EQ(noMatch.data(), data);
+
+    string empty;
+    replaceAll(empty, {{"a", "b"}});
+    ASSERT_EQ(empty, "");
+    ASSERT_THROW(replaceAll(empty, {{"", "b"}}), invalid_argument);
+
+    wstring wide = L"Grüße aus Köln, Grüße! 5 € ≈ 5 $";
+    replaceAll(wide, {{L"Grüße", L"Hallo"}, {L"ö", L"oe"}, {L"€", L"EUR"}, {L"≈ 5 $", L"= 5.8 USD"}});
+    ASSERT_EQ(wide, L"Hallo aus Koeln, Hallo! 5 EUR = 5.8 USD");
+}
+
+TEST_F(ReplaceAllTest, util_replace_all_matches_naive_test)
+{
+    // patterns over a small alphabet overlap in every possible way
+    vector<vector<pair<string_view, string_view>>> const patternSets{
+        {{"a", "1"}},
+        {{"ab", "<>"}, {"b", ""}, {"bab", "!"}},
+        {{"aa", "x"}, {"aaa", "yy"}, {"a", "z"}},
+        {{"abcab", "#"}, {"bca", "$"}, {"c", "cc"}, {"cabc", "%"}},
+        {{"abcabcabd", "X"}, {"bcab", "Y"}, {"ca", ""}},
+    };
+    for (auto const &replacements: patternSets)
+    {
+        ReplaceAutomaton<char> const automaton{replacements};
+        for (unsigned seed = 0U; seed < 200U; seed++)
+        {
+            auto const alphabet = string_view{"abcd"}.substr(0UL, seed % 2U == 0U ? 3UL : 4UL);
+            auto const source   = test::pseudoRandomString<char>(alphabet, seed % 50U, seed);
+            auto       actual   = source;
+            replaceAll(actual, automaton);
+            ASSERT_EQ(actual, naiveReplaceAll(source, replacements)) << "source='" << source << "'";
+        }
+    }
+}
+
+TEST_F(ReplaceAllTest, util_ci_replace_all_test)
+{
+    // util::ci_string matches with its traits
+    ci_string ci = "Select * FROM t where X = 1";
+    replaceAll(ci, {{"select", "SELECT"}, {"from", "FROM"}, {"where", "WHERE"}});
+    ASSERT_EQ(convert<string>(ci), "SELECT * FROM t WHERE X = 1");
+
+    string plain = "Select * FROM t where X = 1";
+    replaceAll(plain, {{"select", "SELECT"}});
+    ASSERT_EQ(plain, "Select * FROM t where X = 1");
+    ciReplaceAll(plain, {{"select", "SELECT"}, {"from", "FROM"}, {"where", "WHERE"}});
+    ASSERT_EQ(plain, "SELECT * FROM t WHERE X = 1");
+
+    // case-variants of one pattern are the same pattern, the last replacement counts
+    string dupes = "aAaA";
+    ciReplaceAll(dupes, {{"aa", "1"}, {"AA", "2"}});
+    ASSERT_EQ(dupes, "22");
+
+    wstring wide = L"Straße, STRASSE, strasse";
+    ciReplaceAll(wide, {{L"strasse", L"Weg"}});
+    ASSERT_EQ(wide, L"Straße, Weg, Weg");
+}
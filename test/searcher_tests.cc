@@ -0,0 +1,263 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/searcher_tests.cc
+ * Description: Unit tests for the precompiled substring search.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "searcher.h"
+#include "stringutil.h"
+#include "test_strings.h"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class SearcherTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    /**
+     * @brief A haystack over a small alphabet, so that needles match often and partially match even more often.
+     */
+    template <typename CharT_> static basic_string<CharT_> haystackOf(size_t len, unsigned seed)
+    {
+        return test::pseudoRandomString<CharT_>(string_view{"abcab"}, len, seed);
+    }
+
+    /**
+     * @brief Find by trying every position with ci_char_traits::eq.
+     */
+    template <typename CharT_>
+    static size_t naiveCiFind(basic_string<CharT_> const &haystack, basic_string<CharT_> const &needle, size_t pos)
+    {
+        for (; pos + needle.size() <= haystack.size(); pos++)
+        {
+            size_t j = 0UL;
+            while (j < needle.size() && ci_char_traits<CharT_>::eq(haystack[pos + j], needle[j]))
+            {
+                j++;
+            }
+            if (j == needle.size())
+            {
+                return pos;
+            }
+        }
+
+        return basic_string<CharT_>::npos;
+    }
+
+    /**
+     * @brief A mixed-case haystack with non-ASCII characters and characters differing from letters only in bit 0x20.
+     */
+    template <typename CharT_> static basic_string<CharT_> mixedCaseHaystackOf(size_t len, unsigned seed)
+    {
+        static constexpr unsigned alphabet[] = {'a', 'A', 'b', 'B', '@', '`', '[', '{', 0xE4U, 0xC4U, 'a', 'b'};
+
+        return test::pseudoRandomString<CharT_>(alphabet, len, seed);
+    }
+
+    /**
+     * @brief Compare every position util::Searcher finds with std::basic_string_view::find.
+     */
+    template <typename CharT_> static void expectSameAsStd(basic_string<CharT_> const &haystack, size_t needleLen)
+    {
+        basic_string_view<CharT_> const view{haystack};
+        for (size_t from = 0UL; from + needleLen <= view.size(); from += 1UL + from / 4U)
+        {
+            auto const needle = view.substr(from, needleLen);
+            Searcher<CharT_> const searcher{needle};
+            for (size_t pos = 0UL; pos <= view.size() + 1UL; pos += 1UL + pos / 2U)
+            {
+                ASSERT_EQ(searcher.find(view, pos), view.find(needle, pos))
+                    << "len=" << view.size() << " needleLen=" << needleLen << " from=" << from << " pos=" << pos;
+            }
+        }
+    }
+};
+
+TEST_F(SearcherTest, util_searcher_test)
+{
+    string const text = "the quick brown fox jumps over the lazy dog";
+
+    ASSERT_EQ(util::find(text, "the"), 0UL);
+    ASSERT_EQ(util::find(text, "the", 1UL), 31UL);
+    ASSERT_EQ(util::find(text, "dog"), 40UL);
+    ASSERT_EQ(util::find(text, "cat"), string::npos);
+    ASSERT_EQ(util::find(text, 'q'), 4UL);
+    ASSERT_EQ(util::find(text, ""), 0UL);
+    ASSERT_EQ(util::find(text, "", text.size()), text.size());
+    ASSERT_EQ(util::find(text, "", text.size() + 1UL), string::npos);
+    ASSERT_EQ(util::find(text, "quick brown fox jumps over the lazy dog"), 4UL);
+    ASSERT_EQ(util::find(text, "quick brown fox jumps over the lazy cat"), string::npos);
+    ASSERT_EQ(util::find(string_view{text}, string{"lazy"}), 35UL);
+
+    Searcher<char> const searcher{"o"};
+    ASSERT_EQ(searcher.needle(), "o");
+    ASSERT_EQ(searcher.find(text), 12UL);
+    ASSERT_EQ(searcher.find(text, 13UL), 17UL);
+
+    // a needle longer than the filtered length is searched with Horspool
+    string const longNeedle(Searcher<char>::MAX_FILTERED_LENGTH + 8UL, 'x');
+    string const longText = string(100UL, 'x') + "y" + longNeedle + "y";
+    ASSERT_EQ(util::find(longText, longNeedle), 0UL);
+    ASSERT_EQ(util::find(longText, longNeedle + "y"), 60UL);
+    ASSERT_EQ(util::find(longText, "y" + longNeedle + "y"), 100UL);
+
+    // matches overlapping the SIMD block boundaries
+    for (size_t at = 0UL; at < 100UL; at++)
+    {
+        string block(100UL, '-');
+        block.replace(at, min(3UL, 100UL - at), string_view{"a-b"}.substr(0UL, min(3UL, 100UL - at)));
+        ASSERT_EQ(util::find(block, "a-b"), at + 3UL <= 100UL ? at : string::npos) << "at=" << at;
+    }
+}
+
+TEST_F(SearcherTest, util_searcher_matches_std_test)
+{
+    for (unsigned seed = 0U; seed < 5U; seed++)
+    {
+        for (size_t len: {0UL, 1UL, 15UL, 16UL, 17UL, 31UL, 33UL, 64UL, 100UL, 300UL})
+        {
+            for (size_t needleLen: {1UL, 2UL, 3UL, 5UL, 16UL, 31UL, 32UL, 33UL, 40UL, 260UL, 290UL})
+            {
+                expectSameAsStd(haystackOf<char>(len, seed), needleLen);
+                expectSameAsStd(haystackOf<char8_t>(len, seed), needleLen);
+                expectSameAsStd(haystackOf<char16_t>(len, seed), needleLen);
+                expectSameAsStd(haystackOf<wchar_t>(len, seed), needleLen);
+            }
+        }
+    }
+
+    // only the low byte indexes the Horspool table
+    u16string const wide = u"šɡxxš͡šɡ͡xx";
+    ASSERT_EQ(util::find(wide, u"ɡ͡xx"), 7UL);
+    ASSERT_EQ(util::find(wide, u"š͡"), 4UL);
+}
+
+TEST_F(SearcherTest, util_ci_searcher_test)
+{
+    ci_string const text = "SELECT name FROM users WHERE name = 'Select'";
+    ASSERT_EQ(util::find(text, "select"), 0UL);
+    ASSERT_EQ(util::find(text, "select", 1UL), 37UL);
+    ASSERT_EQ(util::find(text, "where"), 23UL);
+    ASSERT_EQ(util::find(text, "Users WHERE Name"), 17UL);
+    ASSERT_EQ(util::find(text, "update"), ci_string::npos);
+
+    // long needles are found with case-folded Horspool shifts
+    ci_string const longText = ci_string(47UL, 'x') + " The Quick Brown Fox Jumps Over The Lazy Dog";
+    ASSERT_EQ(util::find(longText, "the quick brown fox jumps over the lazy dog"), 48UL);
+    ASSERT_EQ(util::find(longText, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG"), 48UL);
+    ASSERT_EQ(util::find(longText, "THE QUICK BROWN FOX JUMPS OVER THE LAZY CAT"), ci_string::npos);
+
+    ci_wstring const wide = L"Die Straße heißt STRASSE und nicht strasse";
+    ASSERT_EQ(util::find(wide, L"strasse und nicht"), 17UL);
+    ASSERT_EQ(util::find(wide, L"STRASSE", 18UL), 35UL);
+}
+
+TEST_F(SearcherTest, util_split_with_searcher_test)
+{
+    string const csv = "a::b::::c::";
+    ASSERT_EQ(splitIntoVector(csv, "::"), (vector<string>{"a", "b", "", "c", ""}));
+    ASSERT_EQ(splitIntoVector(csv, string{":::"}), (vector<string>{"a::b", ":c::"}));
+
+    // long separators are searched with Horspool
+    string const longSep = "<-------------------------------------->";
+    string const joined  = "one" + longSep + longSep + "two" + longSep;
+    ASSERT_EQ(splitIntoVector(joined, longSep), (vector<string>{"one", "", "two", ""}));
+
+    ci_string const ci = "aANDbandcAnD";
+    ASSERT_EQ(splitIntoVector(ci, "and"), (vector<ci_string>{"a", "b", "c", ""}));
+}
+
+TEST_F(SearcherTest, util_ci_find_test)
+{
+    // std::strings and views are searched ignoring the case, util::find keeps it
+    string const text = "Content-Type: text/html; CHARSET=utf-8";
+    ASSERT_EQ(ciFind(text, "content-type"), 0UL);
+    ASSERT_EQ(ciFind(text, "charset="), 25UL);
+    ASSERT_EQ(ciFind(string_view{text}, "UTF-8"), 33UL);
+    ASSERT_EQ(ciFind(text, 'T'), 3UL);
+    ASSERT_EQ(ciFind(text, 't', 4UL), 6UL);
+    ASSERT_EQ(ciFind(text, "text/xml"), string::npos);
+    ASSERT_EQ(util::find(text, "charset="), string::npos);
+    ASSERT_EQ(ciFind(text, "@"), string::npos);
+    ASSERT_EQ(ciFind(text, ""), 0UL);
+
+    // non-letters differing from letters only in bit 0x20 are not folded
+    ASSERT_EQ(ciFind(string{"`[{@"}, "@"), 3UL);
+    ASSERT_EQ(ciFind(string{"`[{@"}, "{"), 2UL);
+
+    ci_string_view const ciView{"Accept: TEXT/HTML"};
+    ASSERT_EQ(util::find(ciView, "text/html"), 8UL);
+    ASSERT_EQ(ciFind(ciView, "accept"), 0UL);
+
+    wstring const wide = L"Größe: KLEIN, Farbe: Blau";
+    ASSERT_EQ(ciFind(wide, L"größe"), 0UL);
+    ASSERT_EQ(ciFind(wide, L"farbe: BLAU"), 14UL);
+    ASSERT_EQ(ciFind(wide, L'k'), 7UL);
+}
+
+TEST_F(SearcherTest, util_ci_find_matches_naive_test)
+{
+    for (unsigned seed = 0U; seed < 5U; seed++)
+    {
+        for (size_t len: {0UL, 1UL, 15UL, 16UL, 17UL, 33UL, 64UL, 100UL, 300UL})
+        {
+            auto const haystack     = mixedCaseHaystackOf<char>(len, seed);
+            auto const wideHaystack = mixedCaseHaystackOf<wchar_t>(len, seed);
+            for (size_t needleLen: {1UL, 2UL, 3UL, 17UL, 32UL, 33UL, 40UL})
+            {
+                for (unsigned variant = 0U; variant < 4U; variant++)
+                {
+                    auto needle     = mixedCaseHaystackOf<char>(needleLen, seed + variant);
+                    auto wideNeedle = mixedCaseHaystackOf<wchar_t>(needleLen, seed + variant);
+                    if (variant % 2U == 1U && needleLen <= len)
+                    {
+                        // a case-variant of a part of the haystack, so that there are matches
+                        needle     = toUpper(haystack.substr(len - needleLen));
+                        wideNeedle = toUpper(wideHaystack.substr(len - needleLen));
+                    }
+                    for (size_t pos = 0UL; pos <= len; pos += 1UL + pos / 2U)
+                    {
+                        ASSERT_EQ(ciFind(haystack, needle, pos), naiveCiFind(haystack, needle, pos))
+                            << "len=" << len << " needle='" << needle << "' pos=" << pos;
+                        ASSERT_EQ(ciFind(wideHaystack, wideNeedle, pos), naiveCiFind(wideHaystack, wideNeedle, pos))
+                            << "len=" << len << " needleLen=" << needleLen << " pos=" << pos;
+                    }
+                }
+            }
+        }
+    }
+}
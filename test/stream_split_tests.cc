@@ -0,0 +1,258 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/stream_split_tests.cc
+ * Description: Unit tests for splitting streams and file descriptors incrementally.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "stream_split.h"
+#include "stringutil.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class StreamSplitTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    template <typename CharT_> static vector<basic_string<CharT_>> collect(StreamSplitter<CharT_> splitter)
+    {
+        vector<basic_string<CharT_>> tokens;
+        for (auto token: splitter)
+        {
+            tokens.emplace_back(token);
+        }
+
+        return tokens;
+    }
+};
+
+/**
+ * @brief Stream buffer generating size characters of numbered lines on the fly, so that arbitrarily large input can
+ *        be split without ever being in memory.
+ */
+class LineGenerator : public streambuf
+{
+  public:
+    explicit LineGenerator(size_t size)
+        : remaining_(size)
+    {
+    }
+
+  protected:
+    int_type underflow() override
+    {
+        if (remaining_ == 0UL)
+        {
+            return traits_type::eof();
+        }
+        line_ = "line " + to_string(lineNumber_++) + '\n';
+        if (line_.size() > remaining_)
+        {
+            line_.resize(remaining_);
+        }
+        remaining_ -= line_.size();
+        setg(line_.data(), line_.data(), line_.data() + line_.size());
+
+        return traits_type::to_int_type(line_[0]);
+    }
+
+  private:
+    size_t remaining_;
+    size_t lineNumber_ = 0UL;
+    string line_;
+};
+
+/**
+ * @brief Stream buffer failing after its first characters, as a device error would.
+ */
+class FailingBuffer : public streambuf
+{
+  protected:
+    int_type underflow() override
+    {
+        if (served_)
+        {
+            throw runtime_error("device error");
+        }
+        served_ = true;
+        setg(data_.data(), data_.data(), data_.data() + data_.size());
+
+        return traits_type::to_int_type(data_[0]);
+    }
+
+  private:
+    bool   served_ = false;
+    string data_   = "a;b;c";
+};
+
+TEST_F(StreamSplitTest, util_stream_split_matches_split_test)
+{
+    vector<string> const sources{
+        "",
+        ",",
+        ",,",
+        "a",
+        "a,b,c",
+        ",a,,b,",
+        "first,second,,third,fourth,,,fifth-is-the-longest-token-of-them-all,",
+        "a<>b<><>c<>",
+        "<><>",
+        "aaaaa,aaaa",
+    };
+    vector<string> const separators{",", "<>", "aa", "a", "not-in-there", ""};
+
+    for (auto const &source: sources)
+    {
+        for (auto const &sep: separators)
+        {
+            auto const expected = splitIntoVector(source, sep);
+            for (size_t chunkSize = 1UL; chunkSize < 12UL; chunkSize++)
+            {
+                istringstream in{source};
+                ASSERT_EQ(collect(streamSplit(in, sep, chunkSize)), expected)
+                    << "source='" << source << "' sep='" << sep << "' chunkSize=" << chunkSize;
+            }
+        }
+        istringstream in{source};
+        ASSERT_EQ(collect(streamSplit(in, ',')), splitIntoVector(source, ','));
+    }
+
+    wistringstream in{L"äpfel;birnen;;kirschen"};
+    ASSERT_EQ(collect(streamSplit(in, L';', 3UL)), (vector<wstring>{L"äpfel", L"birnen", L"", L"kirschen"}));
+}
+
+TEST_F(StreamSplitTest, util_stream_split_next_test)
+{
+    istringstream in{"one two  three"};
+    auto          splitter = streamSplit(in, ' ', 4UL);
+
+    vector<string> tokens;
+    while (auto token = splitter.next())
+    {
+        tokens.emplace_back(*token);
+    }
+    ASSERT_EQ(tokens, (vector<string>{"one", "two", "", "three"}));
+    ASSERT_FALSE(splitter.next().has_value());
+}
+
+TEST_F(StreamSplitTest, util_stream_split_bounded_memory_test)
+{
+    // 64 MiB of lines are split through a 4 KiB chunk, the buffer never exceeds chunk plus longest line
+    constexpr size_t inputSize = 64UL * 1'024UL * 1'024UL;
+    constexpr size_t chunkSize = 4UL * 1'024UL;
+    LineGenerator    generator{inputSize};
+    istream          in{&generator};
+    auto             splitter = streamSplit(in, '\n', chunkSize);
+
+    size_t tokenCount = 0UL;
+    size_t totalSize  = 0UL;
+    for (auto token: splitter)
+    {
+        if (tokenCount == 0UL)
+        {
+            ASSERT_EQ(token, "line 0");
+        }
+        tokenCount++;
+        totalSize += token.size() + 1UL;
+    }
+    ASSERT_EQ(totalSize - 1UL, inputSize);
+    ASSERT_GT(tokenCount, inputSize / 20UL);
+    ASSERT_LE(splitter.bufferSize(), 2UL * chunkSize);
+}
+
+TEST_F(StreamSplitTest, util_fd_split_test)
+{
+    string const source = "alpha\r\nbeta\r\n\r\ngamma\r\n";
+    auto        *file   = tmpfile();
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(source.data(), 1UL, source.size(), file), source.size());
+    fflush(file);
+    rewind(file);
+
+    ASSERT_EQ(collect(fdSplit(fileno(file), "\r\n", 5UL)), splitIntoVector(source, "\r\n"));
+    fclose(file);
+
+    ASSERT_THROW(fdSplit(-1, '\n').next(), system_error);
+
+    // read errors of streams are reported like those of file descriptors, not taken as the end of the input
+    FailingBuffer failing;
+    istream       in{&failing};
+    ASSERT_THROW(collect(streamSplit(in, ';', 2UL)), system_error);
+}
+
+TEST_F(StreamSplitTest, util_stream_split_utf8_validation_test)
+{
+    // characters straddling the chunks are validated with the next chunk
+    string const source = "äpfel;birnen;;kirschen;€uro;𝄞";
+    for (size_t chunkSize = 1UL; chunkSize < 12UL; chunkSize++)
+    {
+        istringstream in{source};
+        ASSERT_EQ(collect(streamSplit(in, ';', chunkSize, InputValidation::UTF8)), splitIntoVector(source, ';'))
+            << "chunkSize=" << chunkSize;
+    }
+
+    for (string const bad: {"äpfel;\xC3;birnen", "äpfel;birnen;\xED\xA0\x80", "äpfel;birnen;\xF0\x9D\x84"})
+    {
+        for (size_t chunkSize = 1UL; chunkSize < 12UL; chunkSize++)
+        {
+            istringstream in{bad};
+            ASSERT_THROW(collect(streamSplit(in, ';', chunkSize, InputValidation::UTF8)), invalid_argument)
+                << "chunkSize=" << chunkSize;
+        }
+    }
+
+    try
+    {
+        istringstream in{string(100'000UL, 'x') + "\xE2\x82;"};
+        collect(streamSplit(in, ';', 4'096UL, InputValidation::UTF8));
+        FAIL() << "invalid UTF-8 not detected";
+    }
+    catch (invalid_argument const &e)
+    {
+        ASSERT_EQ(string{e.what()}, "util::StreamSplitter: invalid UTF-8 at byte 100000");
+    }
+
+    // without validation the bytes are split as they are
+    istringstream in{"\xC3;\xFF"};
+    ASSERT_EQ(collect(streamSplit(in, ';')), (vector<string>{"\xC3", "\xFF"}));
+
+    wistringstream wide{L"äpfel"};
+    ASSERT_THROW(streamSplit(wide, L';', 3UL, InputValidation::UTF8), invalid_argument);
+}
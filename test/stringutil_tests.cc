@@ -28,11 +28,20 @@
 #include "stringutil.h"
 
 #include <dkyb/container_convert.h>
+#include <array>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <optional>
 #include <source_location>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 using namespace std;
 using namespace util;
@@ -720,3 +729,600 @@ TEST_F(StringUtilTest, util_string_test)
     util_string_left_right_testT<string>();
     util_string_left_right_testT<ci_string>();
 }
+
+template <typename T_> T_ referenceCaseConversion(T_ const &str, bool upper)
+{
+    using char_type = typename T_::value_type;
+    T_ reval;
+    for (auto c: str)
+    {
+        reval += static_cast<char_type>(upper ? towupper(static_cast<wchar_t>(c)) : towlower(static_cast<wchar_t>(c)));
+    }
+    return reval;
+}
+
+template <typename T_> void util_case_conversion_testT()
+{
+    using char_type = typename T_::value_type;
+    // cover every block/tail split of the SIMD kernels, with and without non-ASCII characters in a block
+    T_ const pattern = util::convert<T_>(std::string{"Hello, World! [ABC-xyz_@`{] 0123456789 "});
+    for (size_t len = 0UL; len < 3UL * std::size(pattern); len++)
+    {
+        T_ mixed;
+        for (size_t i = 0UL; i < len; i++)
+        {
+            mixed += pattern[i % std::size(pattern)];
+        }
+        ASSERT_EQ(toLower(mixed), referenceCaseConversion(mixed, false));
+        ASSERT_EQ(toUpper(mixed), referenceCaseConversion(mixed, true));
+
+        for (size_t nonAsciiPos = 0UL; nonAsciiPos < len; nonAsciiPos += 7UL)
+        {
+            T_ withNonAscii      = mixed;
+            withNonAscii[nonAsciiPos] = static_cast<char_type>(0xC4);
+            ASSERT_EQ(toLower(withNonAscii), referenceCaseConversion(withNonAscii, false));
+            ASSERT_EQ(toUpper(withNonAscii), referenceCaseConversion(withNonAscii, true));
+        }
+    }
+}
+
+TEST_F(StringUtilTest, util_case_conversion_test)
+{
+    util_case_conversion_testT<string>();
+    util_case_conversion_testT<ci_string>();
+    util_case_conversion_testT<wstring>();
+    util_case_conversion_testT<u16string>();
+    util_case_conversion_testT<u32string>();
+
+    ASSERT_EQ(toLower(string{"\xC3\x84pfel UND Birnen"}), string{"\xC3\x84pfel und birnen"});
+    ASSERT_EQ(toUpper(wstring{L"äpfel und Birnen"}), referenceCaseConversion(wstring{L"äpfel und Birnen"}, true));
+}
+
+TEST_F(StringUtilTest, util_case_conversion_in_place_test)
+{
+    string headerKey{"Content-Type"};
+    toLowerInPlace(headerKey);
+    ASSERT_EQ(headerKey, "content-type");
+    toUpperInPlace(headerKey);
+    ASSERT_EQ(headerKey, "CONTENT-TYPE");
+
+    ci_string ciKey{"X-Forwarded-For"};
+    toLowerInPlace(ciKey);
+    ASSERT_EQ(util::convert<string>(ciKey), "x-forwarded-for");
+
+    // the rvalue overloads hand back the buffer of their argument
+    string      longKey(200UL, 'K');
+    char const *buffer = longKey.data();
+    string      lower  = toLower(std::move(longKey));
+    ASSERT_EQ(lower, string(200UL, 'k'));
+    ASSERT_EQ(lower.data(), buffer);
+    string upper = toUpper(std::move(lower));
+    ASSERT_EQ(upper, string(200UL, 'K'));
+    ASSERT_EQ(upper.data(), buffer);
+
+    // output iterators and caller-owned storage
+    string const source{"Accept-Encoding: GZIP"};
+    string       appended{"key="};
+    toLower(source, back_inserter(appended));
+    ASSERT_EQ(appended, "key=accept-encoding: gzip");
+
+    char  raw[64]{};
+    auto *rawEnd = toUpper(string_view{source}, raw);
+    ASSERT_EQ(string(raw, rawEnd), "ACCEPT-ENCODING: GZIP");
+
+    array<char, 8> fixed{};
+    ASSERT_EQ(toLower(source, span{fixed}), fixed.size());
+    ASSERT_EQ(string(fixed.data(), fixed.size()), "accept-e");
+    vector<wchar_t> wide(4UL);
+    ASSERT_EQ(toUpper(wstring_view{L"abc"}, span{wide}), 3UL);
+    ASSERT_EQ(wstring(wide.data(), 3UL), L"ABC");
+
+    // longer than the internal chunk of the iterator variant
+    string const longSource = string(1'000UL, 'A') + "\xC4" + string(1'000UL, 'b');
+    string       viaIterator;
+    toLower(longSource, back_inserter(viaIterator));
+    ASSERT_EQ(viaIterator, toLower(longSource));
+}
+
+template <typename T_> T_ referenceStrip(T_ const &str, T_ const &stripChars, StripTrimMode mode)
+{
+    auto const isStripChar = [&](auto c) { return stripChars.find(c) != T_::npos; };
+    size_t     start       = 0UL;
+    size_t     finish      = str.size();
+    while (isModeSet(mode, StripTrimMode::FRONT) && start < finish && isStripChar(str[start]))
+    {
+        start++;
+    }
+    while (isModeSet(mode, StripTrimMode::BACK) && finish > start && isStripChar(str[finish - 1]))
+    {
+        finish--;
+    }
+    T_ reval;
+    for (size_t i = start; i < finish; i++)
+    {
+        if (!isModeSet(mode, StripTrimMode::INSIDE) || !isStripChar(str[i]))
+        {
+            reval += str[i];
+        }
+    }
+    return reval;
+}
+
+template <typename T_> void util_strip_long_testT(T_ const &stripChars)
+{
+    using enum StripTrimMode;
+    // long enough for the vectorised compaction, with all sorts of strip-char densities per block
+    T_ const alphabet = util::convert<T_>(std::string{"abcXYZ \t_.-/0123"});
+    for (size_t density = 1UL; density < 40UL; density += 3UL)
+    {
+        T_ source;
+        for (size_t i = 0UL; i < 3'000UL; i++)
+        {
+            source += (i * 7UL) % density == 0UL ? stripChars[i % std::size(stripChars)] : alphabet[(i * 13UL) % 16UL];
+        }
+        for (auto mode: {ALL, INSIDE, OUTSIDE, FRONT, BACK})
+        {
+            T_ stripped = source;
+            strip(stripped, stripChars, mode);
+            ASSERT_EQ(stripped, referenceStrip(source, stripChars, mode)) << "density=" << density;
+        }
+    }
+}
+
+TEST_F(StringUtilTest, util_strip_long_test)
+{
+    util_strip_long_testT<string>(" _.");
+    util_strip_long_testT<string>("\xC4\x80 abcdefghijklmnopqrstuvwxyz");
+    util_strip_long_testT<ci_string>(" _aZ");
+    util_strip_long_testT<wstring>(L" _.€");
+
+    // the strip-set of a case-insensitive string matches both cases, also on the vectorised path
+    ci_string longCi = ci_string(2'000UL, 'a') + "xXx" + ci_string(2'000UL, 'A');
+    strip(longCi, "a");
+    ASSERT_EQ(util::convert<string>(longCi), "xXx");
+
+    // an empty set only strips white-space, and only when stripping inside
+    string withBlanks = " a b\tc ";
+    strip(withBlanks, "", StripTrimMode::OUTSIDE);
+    ASSERT_EQ(withBlanks, " a b\tc ");
+    strip(withBlanks, "");
+    ASSERT_EQ(withBlanks, "abc");
+}
+
+template <typename T_> void util_translate_long_testT(T_ const &fromChars)
+{
+    using enum StripTrimMode;
+    // long enough for the vectorised translation, with all sorts of from-char densities per block
+    T_ const alphabet = util::convert<T_>(std::string{"abcXYZ \t_.-/0123"});
+    T_ const toChars  = util::convert<T_>(std::string{"#"});
+    for (size_t density = 1UL; density < 40UL; density += 3UL)
+    {
+        T_ source;
+        for (size_t i = 0UL; i < 300UL; i++)
+        {
+            source += (i * 7UL) % density == 0UL ? fromChars[i % std::size(fromChars)] : alphabet[(i * 13UL) % 16UL];
+        }
+        auto const frontInside = StripTrimMode(to_underlying(FRONT) | to_underlying(INSIDE));
+        auto const backInside  = StripTrimMode(to_underlying(BACK) | to_underlying(INSIDE));
+        for (auto mode: {ALL, INSIDE, OUTSIDE, FRONT, BACK, frontInside, backInside})
+        {
+            // a single translation equals replaceChar
+            T_ translated = source;
+            translate(translated, fromChars, toChars, mode);
+            T_ replaced = source;
+            replaceChar(replaced, fromChars, toChars[0], mode);
+            ASSERT_EQ(translated, replaced) << "density=" << density << " mode=" << static_cast<int>(mode);
+        }
+    }
+}
+
+TEST_F(StringUtilTest, util_translate_test)
+{
+    util_translate_long_testT<string>(",;|\x01\x7F");
+    util_translate_long_testT<string>("\xC4\x80 abcdefghijklmnopqrstuvwxyz");
+    util_translate_long_testT<ci_string>(" _aZ");
+    util_translate_long_testT<wstring>(L" _.€");
+
+    // sanitise field separators and control characters of a record in one pass
+    string record = "id=7;name=a|b\tc\r\n";
+    translate(record, ";|\t\r\n", ",/ ");
+    ASSERT_EQ(record, "id=7,name=a/b c  ");
+
+    // characters are translated simultaneously, the last occurrence of a from-char counts
+    string swapped = string(100UL, 'a') + "bc";
+    translate(swapped, "abb", "bax");
+    ASSERT_EQ(swapped, string(100UL, 'b') + "xc");
+
+    // translations to non-ASCII characters and of non-ASCII characters
+    string nonAscii = string(100UL, '-') + "\xFF";
+    translate(nonAscii, "-\xFF", "\xFE+");
+    ASSERT_EQ(nonAscii, string(100UL, '\xFE') + "+");
+
+    ci_string ci = "aAbB";
+    translate(ci, "a", "x");
+    ASSERT_EQ(util::convert<string>(ci), "xxbB");
+
+    wstring wide = L"€ und $";
+    translate(wide, L"€$", L"EU");
+    ASSERT_EQ(wide, L"E und U");
+
+    string unchanged = "abc";
+    translate(unchanged, "", "");
+    ASSERT_EQ(unchanged, "abc");
+    ASSERT_THROW(translate(unchanged, "a", ""), invalid_argument);
+}
+
+TEST_F(StringUtilTest, util_trimmed_view_test)
+{
+    // a read-only buffer, f.e. a network frame
+    static constexpr char frame[] = " \t GET /index.html HTTP/1.1\r\n";
+    string_view const     request{frame};
+    auto const            trimmed = trimmedView(request);
+    ASSERT_EQ(trimmed, "GET /index.html HTTP/1.1");
+    ASSERT_EQ(trimmed.data(), frame + 3);
+
+    ASSERT_EQ(strippedView(request, CharClass::WHITESPACE, StripTrimMode::LEFT), "GET /index.html HTTP/1.1\r\n");
+    ASSERT_EQ(strippedView(request, " \r\n", StripTrimMode::RIGHT), " \t GET /index.html HTTP/1.1");
+    // the interior of a view cannot be removed, so INSIDE is ignored
+    ASSERT_EQ(strippedView(request, " \t\r\n", StripTrimMode::ALL), "GET /index.html HTTP/1.1");
+    ASSERT_EQ(trimmedView(request, " \t\r\n"), "GET /index.html HTTP/1.1");
+    ASSERT_EQ(trimmedView(string_view{" \t "}), "");
+    ASSERT_EQ(trimmedView(string_view{}), "");
+    ASSERT_EQ(trimmedView(request, ""), request);
+
+    string const owned{"__value__"};
+    auto const   fromString = trimmedView(owned, "_");
+    ASSERT_EQ(fromString, "value");
+    ASSERT_EQ(fromString.data(), owned.data() + 2);
+
+    wstring_view const wide{L"€€ wert €€"};
+    ASSERT_EQ(trimmedView(wide, L"€ "), L"wert");
+    u32string_view const utf32{U"\tä\t"};
+    ASSERT_EQ(trimmedView(utf32), U"ä");
+
+    // views with case-insensitive traits strip both cases
+    ci_string_view const ci{"aAxyzAa"};
+    ASSERT_EQ(trimmedView(ci, "a"), ci_string_view{"xyz"});
+    ci_string const ciOwned{"bBxyzbB"};
+    ASSERT_EQ(trimmedView(ciOwned, "B"), ci_string_view{"XYZ"});
+    ASSERT_EQ(strippedView(ciOwned, CharSet{"b"}, StripTrimMode::FRONT), ci_string_view{"BxyzbB"});
+}
+
+TEST_F(StringUtilTest, util_split_view_test)
+{
+    static_assert(std::ranges::forward_range<SplitView<char>>);
+    static_assert(std::ranges::view<SplitView<char>>);
+
+    // the tokens are those of splitIntoVector, including empty leading, trailing and touching fields
+    for (string const source: {"", "/", "//", "a", "/a", "a/", "a//b", "/a/b/", "123/3456/7890a", "no separator"})
+    {
+        vector<string> const expected = splitIntoVector(source, '/');
+        vector<string>       tokens;
+        for (auto token: splitView(source, '/'))
+        {
+            ASSERT_GE(token.data(), source.data());
+            ASSERT_LE(token.data() + token.size(), source.data() + source.size());
+            tokens.emplace_back(token);
+        }
+        ASSERT_EQ(tokens, expected) << "source='" << source << "'";
+    }
+
+    string const source = "1::4::::7::";
+    vector<string> tokens;
+    for (auto token: splitView(source, "::"))
+    {
+        tokens.emplace_back(token);
+    }
+    ASSERT_EQ(tokens, (vector<string>{"1", "4", "", "7", ""}));
+    ASSERT_EQ(std::ranges::distance(splitView(source, "")), 1);
+    ASSERT_EQ(*splitView(source, "").begin(), source);
+    ASSERT_EQ(std::ranges::distance(splitView(source, string{":"})), 9);
+
+    // composes with the standard range adaptors
+    string const tsv    = "2026-10-16\tINFO\tlogin\tuser=42\tok";
+    auto         fields = splitView(tsv, '\t');
+    auto const   third  = std::ranges::next(fields.begin(), 2);
+    ASSERT_EQ(*third, "login");
+    auto sizes = fields | std::views::transform([](string_view field) { return field.size(); }) | std::views::take(3);
+    vector<size_t> firstSizes;
+    for (auto size: sizes)
+    {
+        firstSizes.push_back(size);
+    }
+    ASSERT_EQ(firstSizes, (vector<size_t>{10UL, 4UL, 5UL}));
+    ASSERT_EQ(fields.front(), "2026-10-16");
+
+    // the separator is matched with the traits of the string
+    ci_string const ci{"xAyaz"};
+    vector<ci_string> ciTokens;
+    for (auto token: splitView(ci, 'a'))
+    {
+        ciTokens.emplace_back(token);
+    }
+    ASSERT_EQ(ciTokens, splitIntoVector(ci, 'a'));
+    ASSERT_EQ(ciTokens.size(), 3UL);
+
+    wstring_view const wide{L"α,β,,γ"};
+    auto const         wideTokens = splitView(wide, L',');
+    ASSERT_EQ(std::ranges::distance(wideTokens), 4);
+    ASSERT_EQ(*std::ranges::next(wideTokens.begin(), 3), L"γ");
+}
+
+TEST_F(StringUtilTest, util_split_long_test)
+{
+    // separators on and around every block boundary of the 64-byte kernel and its tail loops
+    for (size_t len: {0UL, 1UL, 7UL, 8UL, 15UL, 16UL, 31UL, 32UL, 63UL, 64UL, 65UL, 127UL, 200UL})
+    {
+        for (size_t stride: {1UL, 2UL, 3UL, 7UL, 16UL, 33UL})
+        {
+            string source(len, 'x');
+            for (size_t i = stride - 1UL; i < len; i += stride)
+            {
+                source[i] = '\t';
+            }
+            source += "\xE9\t"; // a non-ASCII byte next to a separator
+
+            vector<string> expected;
+            for (auto token: splitView(source, '\t'))
+            {
+                expected.emplace_back(token);
+            }
+            ASSERT_EQ(expected.size(), 1UL + static_cast<size_t>(std::ranges::count(source, '\t')));
+            ASSERT_EQ(splitIntoVector(source, '\t'), expected) << "len=" << len << " stride=" << stride;
+            ASSERT_EQ(splitIntoVector(source, "\t"), expected) << "len=" << len << " stride=" << stride;
+            ASSERT_EQ(splitIntoSet(source, '\t'), (set<string, std::less<>>(expected.begin(), expected.end())));
+        }
+    }
+}
+
+TEST_F(StringUtilTest, util_split_delimiter_set_test)
+{
+    string const record = "key=value; flag ,list=a,b";
+    ASSERT_EQ(
+        splitIntoVector(record, CharSet{"=;, "}),
+        (vector<string>{"key", "value", "", "flag", "", "list", "a", "b"})
+    );
+    ASSERT_EQ(
+        splitIntoVector(record, CharSet{"=;, "}, DelimiterMode::COLLAPSE_RUNS),
+        (vector<string>{"key", "value", "flag", "list", "a", "b"})
+    );
+    // leading and trailing runs still delimit an empty token
+    string const padded = " \t one  two\t\tthree \n";
+    ASSERT_EQ(
+        splitIntoVector(padded, CharClass::WHITESPACE, DelimiterMode::COLLAPSE_RUNS),
+        (vector<string>{"", "one", "two", "three", ""})
+    );
+    ASSERT_EQ(splitIntoVector(string{}, CharClass::WHITESPACE), (vector<string>{""}));
+    ASSERT_EQ(splitIntoVector(string{"abc"}, CharSet{}), (vector<string>{"abc"}));
+    ASSERT_EQ(splitIntoVector(string{"  "}, CharClass::BLANK, DelimiterMode::COLLAPSE_RUNS), (vector<string>{"", ""}));
+
+    auto const tags = splitIntoSet(string{"b a,c;;a b"}, CharSet{" ,;"}, DelimiterMode::COLLAPSE_RUNS);
+    ASSERT_EQ(tags, (set<string, std::less<>>{"a", "b", "c"}));
+
+    // compare against a character-by-character split, on and around every block boundary
+    for (size_t len: {15UL, 16UL, 17UL, 63UL, 64UL, 65UL, 130UL})
+    {
+        for (size_t stride: {1UL, 3UL, 17UL})
+        {
+            string source(len, 'x');
+            for (size_t i = stride - 1UL; i < len; i += stride)
+            {
+                source[i] = i % 2UL == 0UL ? ';' : '\xF6';
+            }
+            vector<string> expected{""};
+            for (auto c: source)
+            {
+                if (c == ';' || c == '\xF6')
+                {
+                    expected.emplace_back();
+                }
+                else
+                {
+                    expected.back() += c;
+                }
+            }
+            ASSERT_EQ(splitIntoVector(source, CharSet{";\xF6"}), expected) << "len=" << len << " stride=" << stride;
+            ASSERT_EQ(splitIntoVector(source, CharSet{";"}), splitIntoVector(source, ';'));
+        }
+    }
+
+    // a set with more members than the listed SSE2 fallback handles
+    string const punctuated = "a!b\"c#d$e%f&g'h(i)j*k+l,m-n.o/p:q;r<s=t>u?v@w[x]y^z_{|}~end";
+    auto const   words      = splitIntoVector(punctuated, CharClass::PUNCT, DelimiterMode::COLLAPSE_RUNS);
+    ASSERT_EQ(words.size(), 27UL);
+    ASSERT_EQ(words.front(), "a");
+    ASSERT_EQ(words.back(), "end");
+
+    wstring const wide = L"α→β→→γ";
+    ASSERT_EQ(splitIntoVector(wide, CharSet{L"→"}, DelimiterMode::COLLAPSE_RUNS), (vector<wstring>{L"α", L"β", L"γ"}));
+}
+
+TEST_F(StringUtilTest, util_pmr_test)
+{
+    std::array<std::byte, 16'384UL>     buffer{};
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    // anything falling back to the default resource throws std::bad_alloc
+    struct DefaultResourceGuard
+    {
+        std::pmr::memory_resource *previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+        ~DefaultResourceGuard()
+        {
+            std::pmr::set_default_resource(previous);
+        }
+    } const guard;
+
+    string_view const line = "Alpha,BETA,,a token that is too long for the small-string buffer,BETA";
+    auto const        fields = splitIntoVector(line, ',', &arena);
+    ASSERT_EQ(fields.size(), 5UL);
+    ASSERT_EQ(fields[3], "a token that is too long for the small-string buffer");
+    ASSERT_EQ(fields.get_allocator().resource(), &arena);
+    ASSERT_EQ(fields[3].get_allocator().resource(), &arena);
+
+    auto const unique = splitIntoSet(line, string_view{","}, &arena);
+    ASSERT_EQ(unique.size(), 4UL);
+    ASSERT_EQ(unique.begin()->get_allocator().resource(), &arena);
+
+    auto const words = splitIntoVector(line, CharSet{", "}, DelimiterMode::COLLAPSE_RUNS, &arena);
+    ASSERT_EQ(words.size(), 13UL);
+    ASSERT_EQ(words.back().get_allocator().resource(), &arena);
+    auto const wordSet = splitIntoSet(line, CharSet{", "}, DelimiterMode::COLLAPSE_RUNS, &arena);
+    ASSERT_EQ(wordSet.size(), 12UL);
+
+    auto lower = toLower(fields[3], &arena);
+    ASSERT_EQ(lower, "a token that is too long for the small-string buffer");
+    auto const upper = toUpper(line, &arena);
+    ASSERT_EQ(upper, "ALPHA,BETA,,A TOKEN THAT IS TOO LONG FOR THE SMALL-STRING BUFFER,BETA");
+    ASSERT_EQ(upper.get_allocator().resource(), &arena);
+    // copies of strings with a memory resource keep using it
+    ASSERT_EQ(toUpper(lower).get_allocator().resource(), &arena);
+
+    // strip, trim and replace work in place and never allocate
+    std::pmr::string padded{"  __a token that is too long for the small-string buffer__  ", &arena};
+    trim(padded);
+    strip(padded, "_");
+    strip(padded, CharSet{"aeiou"});
+    replaceChar(padded, " ", '.');
+    ASSERT_EQ(padded, ".tkn.tht.s.t.lng.fr.th.smll-strng.bffr");
+    ASSERT_EQ(padded.get_allocator().resource(), &arena);
+
+    // the wide and case-insensitive variants
+    wstring_view const wide{L"ä;ö;ü"};
+    ASSERT_EQ(splitIntoVector(wide, L';', &arena).back(), L"ü");
+    ci_string const ci{"xAyaz"};
+    ASSERT_EQ(splitIntoVector(ci, 'a', &arena).size(), 3UL);
+}
+
+TEST_F(StringUtilTest, util_parse_number_test)
+{
+    ASSERT_EQ(parseNumber(string{"42"}), NumberValue{int64_t{42}});
+    ASSERT_EQ(parseNumber(string{"+42"}), NumberValue{int64_t{42}});
+    ASSERT_EQ(parseNumber(string_view{"-9223372036854775808"}), NumberValue{numeric_limits<int64_t>::min()});
+    ASSERT_EQ(parseNumber(string_view{"9223372036854775808"}), NumberValue{uint64_t{9'223'372'036'854'775'808ULL}});
+    ASSERT_EQ(parseNumber(string_view{"18446744073709551615"}), NumberValue{numeric_limits<uint64_t>::max()});
+    ASSERT_EQ(parseNumber(string_view{"18446744073709551616"}), NumberValue{18446744073709551616.0});
+    ASSERT_EQ(parseNumber(string_view{"-9223372036854775809"}), NumberValue{-9223372036854775809.0});
+    ASSERT_EQ(parseNumber(string_view{"12.5"}), NumberValue{12.5});
+    ASSERT_EQ(parseNumber(string_view{"-.5"}), NumberValue{-0.5});
+    ASSERT_EQ(parseNumber(string_view{"+5."}), NumberValue{5.0});
+    ASSERT_EQ(parseNumber(string_view{"1e3"}), NumberValue{1'000.0});
+    ASSERT_EQ(parseNumber(string_view{"2.5E-1"}), NumberValue{0.25});
+
+    for (auto const notANumber:
+         {"", "+", "-", ".", "+-1", "1-2", "12a", " 1", "1 ", "1e", "0x1A", "inf", "nan", "1e999"})
+    {
+        ASSERT_EQ(numberClass(parseNumber(string_view{notANumber})), NumberClass::NONE) << "'" << notANumber << "'";
+    }
+
+    // wide and case-insensitive strings
+    ASSERT_EQ(parseNumber(wstring{L"-17"}), NumberValue{int64_t{-17}});
+    ASSERT_EQ(parseNumber(u32string_view{U"3.75"}), NumberValue{3.75});
+    ASSERT_EQ(numberClass(parseNumber(wstring{L"1٣"})), NumberClass::NONE);
+    ASSERT_EQ(parseNumber(ci_string{"1E2"}), NumberValue{100.0});
+
+    // classifyNumberString agrees with parseNumber
+    ASSERT_EQ(classifyNumberString(string_view{"1000000000000000000"}), NumberClass::INT);
+    ASSERT_EQ(classifyNumberString(string{"12L"}), NumberClass::NONE);
+    ASSERT_EQ(classifyNumberString(wstring{L"1.5e-3"}), NumberClass::FLOAT);
+}
+
+TEST_F(StringUtilTest, util_scan_bool_string_test)
+{
+    vector<pair<string, bool>> const spellings{
+        {"true",  true },
+        {"t",     true },
+        {"yes",   true },
+        {"y",     true },
+        {"1",     true },
+        {"on",    true },
+        {"false", false},
+        {"f",     false},
+        {"no",    false},
+        {"n",     false},
+        {"0",     false},
+        {"off",   false},
+    };
+    for (auto const &[spelling, expected]: spellings)
+    {
+        bool result = !expected;
+        ASSERT_TRUE(scanBoolString(spelling, result)) << spelling;
+        ASSERT_EQ(result, expected) << spelling;
+        result = !expected;
+        ASSERT_TRUE(scanBoolString(toUpper(spelling), result)) << spelling;
+        ASSERT_EQ(result, expected) << spelling;
+        result = !expected;
+        ASSERT_TRUE(scanBoolString(util::convert<wstring>(spelling), result)) << spelling;
+        ASSERT_EQ(result, expected) << spelling;
+    }
+
+    bool result = true;
+    for (auto const notABool: {"", "tru", "truee", "yess", "of", "2", " on", "on ", "ja", "enabled", "nein"})
+    {
+        result = true;
+        ASSERT_FALSE(scanBoolString(string_view{notABool}, result)) << notABool;
+        ASSERT_FALSE(result);
+    }
+    ASSERT_FALSE(scanBoolString(string{"o\0n", 3UL}, result));
+    ASSERT_FALSE(scanBoolString(wstring{L"ﬀ"}, result));
+
+    // views, case-insensitive strings and other char-types
+    ASSERT_TRUE(scanBoolString(string_view{"OfF"}, result));
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(scanBoolString(ci_string{"YeS"}, result));
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(scanBoolString(u16string_view{u"FALSE"}, result));
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(scanBoolString(u32string{U"T"}, result));
+    ASSERT_TRUE(result);
+
+    // the table and the lookup are usable at compile time
+    static_assert(BOOL_VOCABULARY.find(string_view{"On"}) == optional<bool>{true});
+    static_assert(!BOOL_VOCABULARY.find(string_view{"maybe"}).has_value());
+}
+
+namespace
+{
+inline constexpr BoolVocabulary SWITCHES{{
+    {"enabled",  true },
+    {"disabled", false},
+    {"ja",       true },
+    {"nein",     false},
+    {"oui",      true },
+    {"non",      false},
+    {"sí",       true },
+}};
+inline constexpr auto ALL_BOOLS = BOOL_VOCABULARY | SWITCHES;
+} // namespace
+
+TEST_F(StringUtilTest, util_scan_bool_string_vocabulary_test)
+{
+    bool result = false;
+    ASSERT_TRUE(scanBoolString<SWITCHES>(string{"Enabled"}, result));
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(scanBoolString<SWITCHES>(wstring_view{L"NEIN"}, result));
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(scanBoolString<SWITCHES>(string{"Sí"}, result));
+    ASSERT_TRUE(result);
+    ASSERT_FALSE(scanBoolString<SWITCHES>(string{"true"}, result));
+    ASSERT_FALSE(scanBoolString<SWITCHES>(string{"enable"}, result));
+
+    // the union accepts both vocabularies
+    static_assert(ALL_BOOLS.spellings().size() == 19UL);
+    for (auto const spelling: {"yes", "on", "OUI", "ja", "1"})
+    {
+        result = false;
+        ASSERT_TRUE(scanBoolString<ALL_BOOLS>(string_view{spelling}, result)) << spelling;
+        ASSERT_TRUE(result) << spelling;
+    }
+    for (auto const spelling: {"off", "Disabled", "NON", "0"})
+    {
+        result = true;
+        ASSERT_TRUE(scanBoolString<ALL_BOOLS>(string_view{spelling}, result)) << spelling;
+        ASSERT_FALSE(result) << spelling;
+    }
+
+    // spellings equal but for the case are rejected; in a constexpr definition that does not compile
+    ASSERT_THROW((BoolVocabulary{{{"yes", true}, {"YES", false}}}), invalid_argument);
+    ASSERT_THROW((BoolVocabulary{{{"", true}}}), invalid_argument);
+}
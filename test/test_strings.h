@@ -0,0 +1,59 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/test_strings.h
+ * Description: Generators of test strings shared by the unit tests.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+#ifndef NS_UTIL_TEST_STRINGS_H_INCLUDED
+#define NS_UTIL_TEST_STRINGS_H_INCLUDED
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+namespace util::test
+{
+/**
+ * @brief A reproducible pseudo-random string over an alphabet. Small alphabets make patterns match often and partially
+ *        match even more often; characters listed more than once are drawn more frequently.
+ *
+ * @tparam CharT_ char-type of the string
+ * @tparam AlphabetT_ indexable container of the characters (or code unit values) to draw from
+ * @param alphabet the characters to draw from, must not be empty
+ * @param len length of the string
+ * @param seed seed, different seeds give different strings
+ * @return std::basic_string<CharT_> the string
+ */
+template <typename CharT_, typename AlphabetT_>
+std::basic_string<CharT_> pseudoRandomString(AlphabetT_ const &alphabet, std::size_t len, unsigned seed)
+{
+    std::basic_string<CharT_> reval;
+    for (std::size_t i = 0UL; i < len; i++)
+    {
+        reval += static_cast<CharT_>(alphabet[(seed * 7U + i * i * 13U + i / 3U) % std::size(alphabet)]);
+    }
+
+    return reval;
+}
+} // namespace util::test
+
+#endif // NS_UTIL_TEST_STRINGS_H_INCLUDED
@@ -0,0 +1,184 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/transcode_tests.cc
+ * Description: Unit tests for converting strings between UTF-8, UTF-16 and UTF-32.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "decorator.h"
+#include "transcode.h"
+
+#include <cstddef>
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace util;
+using namespace util::detail;
+
+class TranscodeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(TranscodeTest, util_convert_transcodes_test)
+{
+    // (compared with ==, as GoogleTest may be built without support for printing char8_t)
+    string const   utf8  = "Grüße aus Köln: 5 € ≈ 𝄞 🎉";
+    u16string const utf16 = u"Grüße aus Köln: 5 € ≈ 𝄞 🎉";
+    u32string const utf32 = U"Grüße aus Köln: 5 € ≈ 𝄞 🎉";
+    wstring const   wide  = L"Grüße aus Köln: 5 € ≈ 𝄞 🎉";
+
+    ASSERT_TRUE(convert<u16string>(utf8) == utf16);
+    ASSERT_TRUE(convert<u32string>(utf8) == utf32);
+    ASSERT_TRUE(convert<wstring>(utf8) == wide);
+    ASSERT_TRUE(convert<string>(utf16) == utf8);
+    ASSERT_TRUE(convert<u32string>(utf16) == utf32);
+    ASSERT_TRUE(convert<string>(utf32) == utf8);
+    ASSERT_TRUE(convert<u16string>(utf32) == utf16);
+    ASSERT_TRUE(convert<string>(wide) == utf8);
+    ASSERT_TRUE(convert<u8string>(wide) == u8"Grüße aus Köln: 5 € ≈ 𝄞 🎉");
+    ASSERT_TRUE(convert<char16_t>(u8string{u8"Köln"}) == u"Köln");
+
+    // code units of the same width are copied, also between different traits
+    ASSERT_EQ(convert<string>(ci_string{"MiXeD"}), "MiXeD");
+    ASSERT_TRUE(convert<ci_u16string>(utf8) == ci_u16string{u"GRüßE AUS KöLN: 5 € ≈ 𝄞 🎉"});
+
+    // long ASCII runs are copied block-wise, also around non-ASCII characters
+    string ascii(1'000UL, 'x');
+    ascii[500] = '\x7F';
+    ASSERT_EQ(convert<u32string>(ascii), u32string(ascii.begin(), ascii.end()));
+    auto const mixed = string(100UL, 'a') + "ä" + string(77UL, 'b') + "€";
+    ASSERT_TRUE(convert<u16string>(mixed) == u16string(100UL, u'a') + u"ä" + u16string(77UL, u'b') + u"€");
+    ASSERT_EQ(convert<string>(convert<u16string>(mixed)), mixed);
+
+    ASSERT_TRUE(convert<u32string>(string{}).empty());
+}
+
+TEST_F(TranscodeTest, util_convert_replaces_invalid_test)
+{
+    // every invalid code unit becomes U+FFFD, nothing is truncated
+    ASSERT_TRUE(convert<u32string>(string{"a\xC3" "b\xE2\x82\xFF"}) == U"a�b���");
+    ASSERT_TRUE(convert<u32string>(string{"\xED\xA0\x80"}) == U"���");
+    ASSERT_TRUE(convert<u32string>(u16string{u'x', char16_t(0xD800), u'y', char16_t(0xDC00)}) == U"x�y�");
+    ASSERT_TRUE(convert<string>(u32string{U'a', char32_t(0x11'0000U), char32_t(0xD800U), U'b'}) == "a��b");
+    ASSERT_TRUE(convert<u16string>(u32string{char32_t(0x10'FFFFU)}) == u"\U0010FFFF");
+
+    // a high surrogate pairs with the low surrogate right after it only
+    auto const surrogates = u16string{char16_t(0xD800), char16_t(0xD800), char16_t(0xDC00), char16_t(0xDC00)};
+    ASSERT_EQ(convert<string>(surrogates), "�\U00010000�");
+    ASSERT_TRUE(convert<u32string>(surrogates) == U"�\U00010000�");
+}
+
+template <typename ToCharT_, typename FromCharT_> void checkAsciiRunsAcrossWidths()
+{
+    // a non-ASCII character at every position of a block, and every length around whole blocks
+    for (std::size_t len = 0UL; len <= 70UL; len++)
+    {
+        for (std::size_t pos = 0UL; pos <= len; pos++)
+        {
+            basic_string<FromCharT_> from;
+            basic_string<ToCharT_>   expected;
+            for (std::size_t i = 0UL; i < len; i++)
+            {
+                auto const c = static_cast<char>('0' + i % 64UL);
+                from += i == pos ? static_cast<FromCharT_>(0xC3) : static_cast<FromCharT_>(c);
+                expected += i == pos ? static_cast<ToCharT_>(0xC3) : static_cast<ToCharT_>(c);
+            }
+            if (pos < len && sizeof(FromCharT_) == 1UL)
+            {
+                // alone, the byte C3 is a truncated UTF-8 sequence
+                from.insert(pos + 1UL, 1UL, static_cast<FromCharT_>(0x84));
+                expected[pos] = static_cast<ToCharT_>(0xC4);
+            }
+            if (pos < len && sizeof(ToCharT_) == 1UL)
+            {
+                expected.replace(pos, 1UL, {static_cast<ToCharT_>(0xC3), static_cast<ToCharT_>(0x83)});
+                if (sizeof(FromCharT_) == 1UL)
+                {
+                    expected[pos + 1UL] = static_cast<ToCharT_>(0x84);
+                }
+            }
+            ASSERT_TRUE(convert<basic_string<ToCharT_>>(from) == expected) << "len=" << len << " pos=" << pos;
+        }
+    }
+}
+
+TEST_F(TranscodeTest, util_convert_same_width_and_ascii_runs_test)
+{
+    // same width: copied whatever the traits or signedness of the code units
+    ASSERT_EQ(convert<string>(ci_string{}), "");
+    ASSERT_EQ(convert<string>(ci_string(1'000UL, 'Q')), string(1'000UL, 'Q'));
+    ASSERT_TRUE(convert<ci_string>(string{"Straße"}) == ci_string{"STRAßE"});
+    ASSERT_TRUE(convert<u8string>(string{"\xFF\x80 raw"}) == u8string{u8"\xFF\x80 raw"});
+    ASSERT_TRUE(convert<basic_string<unsigned char>>(string{"ab"}) == (basic_string<unsigned char>{'a', 'b'}));
+    ASSERT_TRUE(convert<u32string>(u32string{char32_t(0x11'0000U)}) == u32string{char32_t(0x11'0000U)});
+
+    // case-insensitive strings hash like their lower-case std::string
+    ASSERT_EQ(hash<ci_string>{}("Content-Type"), hash<string>{}("content-type"));
+    ASSERT_EQ(hash<ci_string>{}("CONTENT-type"), hash<ci_string>{}("content-TYPE"));
+    ASSERT_EQ(hash<ci_u16string>{}(u"AbC"), hash<u16string>{}(u"abc"));
+
+    // different widths: ASCII runs are widened and narrowed block-wise up to the first other character
+    checkAsciiRunsAcrossWidths<char16_t, char>();
+    checkAsciiRunsAcrossWidths<char32_t, char>();
+    checkAsciiRunsAcrossWidths<char, char16_t>();
+    checkAsciiRunsAcrossWidths<char32_t, char16_t>();
+    checkAsciiRunsAcrossWidths<char, char32_t>();
+    checkAsciiRunsAcrossWidths<char16_t, char32_t>();
+}
+
+TEST_F(TranscodeTest, util_convert_round_trip_test)
+{
+    // every Unicode scalar value survives the round trip through every encoding
+    u32string all;
+    for (char32_t cp = 0U; cp <= 0x10'FFFFU; cp++)
+    {
+        if (cp < 0xD800U || cp > 0xDFFFU)
+        {
+            all += cp;
+        }
+    }
+    auto const utf8  = convert<string>(all);
+    auto const utf16 = convert<u16string>(all);
+    ASSERT_EQ(utf8.size(), 0x80UL + 2UL * 0x780UL + 3UL * (0xF800UL - 0x800UL) + 4UL * 0x10'0000UL);
+    ASSERT_EQ(utf16.size(), all.size() + 0x10'0000UL);
+    ASSERT_TRUE(convert<u32string>(utf8) == all);
+    ASSERT_TRUE(convert<u32string>(utf16) == all);
+    ASSERT_TRUE(convert<u16string>(utf8) == utf16);
+    ASSERT_TRUE(convert<string>(utf16) == utf8);
+    ASSERT_TRUE(convert<u32string>(convert<wstring>(utf8)) == all);
+
+    // the counting pass predicts the transcoded length
+    ASSERT_EQ(transcodedLength<char>(all.data(), all.size()), utf8.size());
+    ASSERT_EQ(transcodedLength<char16_t>(utf8.data(), utf8.size()), utf16.size());
+}
@@ -0,0 +1,331 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/utf8_tests.cc
+ * Description: Unit tests for UTF-8 decoding, encoding and case mapping.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "stringutil.h"
+#include "utf8.h"
+
+#include <clocale>
+#include <cwctype>
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+using namespace util::detail;
+
+class Utf8Test : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+
+    static string encoded(char32_t cp)
+    {
+        unsigned char buffer[4];
+        auto const    len = encodeUtf8(cp, buffer);
+
+        return string{reinterpret_cast<char const *>(buffer), len};
+    }
+};
+
+TEST_F(Utf8Test, util_utf8_decode_encode_test)
+{
+    for (char32_t cp = 0U; cp <= 0x10'FFFFU; cp++)
+    {
+        if (cp >= 0xD800U && cp <= 0xDFFFU)
+        {
+            continue;
+        }
+        auto const bytes   = encoded(cp);
+        auto const decoded = decodeUtf8(reinterpret_cast<unsigned char const *>(bytes.data()), bytes.size());
+        ASSERT_EQ(decoded.codePoint, cp);
+        ASSERT_EQ(decoded.length, bytes.size());
+    }
+
+    auto const decodedLength = [](string_view bytes) {
+        return decodeUtf8(reinterpret_cast<unsigned char const *>(bytes.data()), bytes.size()).length;
+    };
+    ASSERT_EQ(decodedLength("\xC3\xA4"), 2UL);
+    ASSERT_EQ(decodedLength("\xC3\xA4rger"), 2UL);
+    ASSERT_EQ(decodedLength("\xC0\x80"), 0UL);             // overlong NUL
+    ASSERT_EQ(decodedLength("\xE0\x80\xAF"), 0UL);         // overlong '/'
+    ASSERT_EQ(decodedLength("\xED\xA0\x80"), 0UL);         // surrogate
+    ASSERT_EQ(decodedLength("\xF4\x90\x80\x80"), 0UL);     // above U+10FFFF
+    ASSERT_EQ(decodedLength("\xE2\x82"), 0UL);             // truncated
+    ASSERT_EQ(decodedLength("\xE2\x28\xAC"), 0UL);         // bad continuation
+    ASSERT_EQ(decodedLength("\x80"), 0UL);                 // stray continuation
+    ASSERT_EQ(decodedLength("\xF8\x88\x80\x80\x80"), 0UL); // 5-byte form
+}
+
+TEST_F(Utf8Test, util_simple_case_test)
+{
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'A'), U'a');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'a'), U'a');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'Ä'), U'ä');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ä'), U'Ä');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'Σ'), U'σ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ς'), U'Σ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'İ'), U'i');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ß'), U'ß');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ſ'), U'S');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'K'), U'k'); // KELVIN SIGN
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'Ǆ'), U'ǆ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'ǅ'), U'ǆ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ǅ'), U'Ǆ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ᾳ'), U'ᾼ');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'Ā'), U'ā');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'ā'), U'ā');
+    ASSERT_EQ(simpleCaseOf<LetterCase::LOWER>(U'Ж'), U'ж');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'𐐨'), U'𐐀');
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'中'), U'中');
+}
+
+TEST_F(Utf8Test, util_simple_case_matches_locale_test)
+{
+    // glibc's C.UTF-8 locale uses the simple case mappings as well; it may be built from a newer Unicode version than
+    // the generated tables, so only the mappings the tables know are compared
+    auto const *const previous = setlocale(LC_CTYPE, nullptr);
+    string const      restore  = previous == nullptr ? "C" : previous;
+    if (setlocale(LC_CTYPE, "C.UTF-8") == nullptr)
+    {
+        GTEST_SKIP() << "no C.UTF-8 locale";
+    }
+    size_t differences = 0UL;
+    for (auto const &range: LOWER_CASE_RANGES)
+    {
+        for (char32_t cp = range.first; cp <= range.last; cp += range.stride)
+        {
+            auto const expected = static_cast<char32_t>(towlower(static_cast<wint_t>(cp)));
+            differences += simpleCaseOf<LetterCase::LOWER>(cp) != expected ? 1UL : 0UL;
+        }
+    }
+    for (auto const &range: UPPER_CASE_RANGES)
+    {
+        for (char32_t cp = range.first; cp <= range.last; cp += range.stride)
+        {
+            auto const expected = static_cast<char32_t>(towupper(static_cast<wint_t>(cp)));
+            differences += simpleCaseOf<LetterCase::UPPER>(cp) != expected ? 1UL : 0UL;
+        }
+    }
+    setlocale(LC_CTYPE, restore.c_str());
+    ASSERT_EQ(differences, 0UL);
+}
+
+TEST_F(Utf8Test, util_utf8_to_lower_upper_test)
+{
+    ASSERT_EQ(utf8ToLower(string{"ÄÖÜ äöü ÀÉÎÕ Straße"}), "äöü äöü àéîõ straße");
+    ASSERT_EQ(utf8ToUpper(string_view{"äöü àéîõ straße"}), "ÄÖÜ ÀÉÎÕ STRAßE");
+    ASSERT_EQ(utf8ToLower(string{"ΣΊΣΥΦΟΣ Москва İSTANBUL"}), "σίσυφοσ москва istanbul");
+    ASSERT_TRUE(utf8ToUpper(u8string{u8"σίσυφος москва"}) == u8"ΣΊΣΥΦΟΣ МОСКВА");
+
+    // characters changing their encoded length
+    ASSERT_EQ(utf8ToUpper(string{"ɐɐ"}), "ⱯⱯ");
+    ASSERT_EQ(utf8ToLower(string{"KK"}), "kk");
+    ASSERT_EQ(utf8ToUpper(string{"ſı"}), "SI");
+    ASSERT_EQ(utf8ToUpper(string{"ɥɡɪ"}), "ꞍꞬꞮ");
+    ASSERT_EQ(utf8ToLower(string{"ꞍꞬꞮ"}), "ɥɡɪ");
+    ASSERT_EQ(simpleCaseOf<LetterCase::UPPER>(U'ɥ'), U'Ɥ');
+
+    // a whole block of 2-byte characters growing to 3 bytes each, at the bound of utf8CaseMappedCapacity
+    string grown;
+    string twoByte;
+    for (size_t i = 0UL; i < 64UL; i++)
+    {
+        twoByte += "ɥ";
+        grown += "Ɥ";
+    }
+    ASSERT_EQ(utf8ToUpper(twoByte), grown);
+    ASSERT_TRUE(toUpper(u8string{reinterpret_cast<char8_t const *>(twoByte.data()), twoByte.size()})
+                == u8string(reinterpret_cast<char8_t const *>(grown.data()), grown.size()));
+
+    // invalid bytes are copied unchanged
+    ASSERT_EQ(utf8ToLower(string{"A\xC3(B\xFF\xE2\x82"}), "a\xC3(b\xFF\xE2\x82");
+
+    // ASCII blocks and non-ASCII characters straddling block boundaries
+    for (size_t prefix = 0UL; prefix < 70UL; prefix++)
+    {
+        string const upper = string(prefix, 'X') + "ÄÖÜ" + string(prefix % 37UL, 'Y') + "ⱯΣ" + string(40UL, 'Z');
+        string const lower = string(prefix, 'x') + "äöü" + string(prefix % 37UL, 'y') + "ɐσ" + string(40UL, 'z');
+        ASSERT_EQ(utf8ToLower(upper), lower) << "prefix=" << prefix;
+        ASSERT_EQ(utf8ToUpper(lower), upper) << "prefix=" << prefix;
+
+        auto inPlace = upper;
+        utf8ToLowerInPlace(inPlace);
+        ASSERT_EQ(inPlace, lower) << "prefix=" << prefix;
+        utf8ToUpperInPlace(inPlace);
+        ASSERT_EQ(inPlace, upper) << "prefix=" << prefix;
+    }
+
+    // every code point maps like simpleCaseOf
+    for (char32_t cp = 0x80U; cp < 0x2'0000U; cp++)
+    {
+        if (cp >= 0xD800U && cp <= 0xDFFFU)
+        {
+            continue;
+        }
+        ASSERT_EQ(utf8ToLower(encoded(cp)), encoded(simpleCaseOf<LetterCase::LOWER>(cp)));
+        ASSERT_EQ(utf8ToUpper(encoded(cp)), encoded(simpleCaseOf<LetterCase::UPPER>(cp)));
+    }
+}
+
+TEST_F(Utf8Test, util_u8string_to_lower_upper_test)
+{
+    // char8_t strings are UTF-8, so toLower and toUpper map them by code point
+    // (compared with ==, as GoogleTest may be built without support for printing char8_t)
+    ASSERT_TRUE(toLower(u8string{u8"GRÜSSE AUS KÖLN"}) == u8"grüsse aus köln");
+    ASSERT_TRUE(toUpper(u8string{u8"grüße aus köln"}) == u8"GRÜßE AUS KÖLN");
+
+    u8string ascii{u8"A PURE ASCII STRING, LONGER THAN ONE BLOCK OF BYTES"};
+    auto const *const data = ascii.data();
+    toLowerInPlace(ascii);
+    ASSERT_TRUE(ascii == u8"a pure ascii string, longer than one block of bytes");
+    ASSERT_EQ(ascii.data(), data);
+
+    u8string mixed{u8"ÉCOLE"};
+    toLowerInPlace(mixed);
+    ASSERT_TRUE(mixed == u8"école");
+
+    // util::ci_u8string compares code unit by code unit, and is case-mapped the same way, also for invalid UTF-8
+    ci_u8string const ci{u8"ÄBc\xE3\xA4"};
+    auto const        lower = toLower(ci);
+    ASSERT_EQ(lower.size(), ci.size());
+    for (size_t i = 0UL; i < ci.size(); i++)
+    {
+        ASSERT_EQ(lower[i], static_cast<char8_t>(towlower(static_cast<wint_t>(ci[i])))) << "i=" << i;
+    }
+    ASSERT_EQ(hash<ci_u8string>{}(u8"ÄBC"), hash<ci_u8string>{}(u8"Äbc"));
+}
+
+TEST_F(Utf8Test, util_utf8_validation_test)
+{
+    ASSERT_TRUE(isValidUtf8(string{}));
+    ASSERT_TRUE(isValidUtf8(string_view{"plain ASCII"}));
+    ASSERT_TRUE(isValidUtf8(string{"Grüße aus Köln, 5 € ≈ 5 $, 𝄞 and \x7F"}));
+    ASSERT_TRUE(isValidUtf8(u8string{u8"ÆØÅ ΑΒΓ АБВ 漢字 🎉"}));
+    ASSERT_TRUE(isValidUtf8(encoded(0x7FU) + encoded(0x80U) + encoded(0x7FFU) + encoded(0x800U) + encoded(0xD7FFU)));
+    ASSERT_TRUE(isValidUtf8(encoded(0xE000U) + encoded(0xFFFFU) + encoded(0x1'0000U) + encoded(0x10'FFFFU)));
+
+    // every kind of invalid sequence is found at any position relative to the SIMD blocks
+    vector<string> const invalid{
+        "\x80",             // stray continuation byte
+        "\xC3\xA4\xBF",     // continuation byte after a complete character
+        "\xC0\x80",         // overlong 2-byte encoding
+        "\xC1\xBF",         // overlong 2-byte encoding
+        "\xE0\x80\x80",     // overlong 3-byte encoding
+        "\xE0\x9F\xBF",     // overlong 3-byte encoding
+        "\xF0\x80\x80\x80", // overlong 4-byte encoding
+        "\xF0\x8F\xBF\xBF", // overlong 4-byte encoding
+        "\xED\xA0\x80",     // surrogate
+        "\xED\xBF\xBF",     // surrogate
+        "\xF4\x90\x80\x80", // above U+10FFFF
+        "\xF5\x80\x80\x80", // above U+10FFFF
+        "\xFF",             // never valid
+        "\xC3",             // truncated
+        "\xE2\x82",         // truncated
+        "\xF0\x9D\x84",     // truncated
+        "\xE2\x82 ",        // too short
+        "\xC3\xC3\xA4",     // too short
+    };
+    for (auto const &bad: invalid)
+    {
+        for (size_t pos = 0UL; pos < 140UL; pos++)
+        {
+            // bytes after the invalid ones, or the end of the input, follow them
+            auto const source = string(pos, 'a') + bad + (pos % 2UL == 0UL ? "" : string(pos % 37UL, 'z'));
+            ASSERT_FALSE(isValidUtf8(source)) << "pos=" << pos;
+            ASSERT_EQ(findInvalidUtf8(source), bad == "\xC3\xA4\xBF" ? pos + 2UL : pos) << "pos=" << pos;
+        }
+    }
+
+    // the position of a truncated character counts, even if it follows valid multi-byte characters
+    auto const text = string{"äöü€𝄞"} + "\xF0\x9D\x84";
+    ASSERT_EQ(findInvalidUtf8(text), text.size() - 3UL);
+    ASSERT_EQ(findInvalidUtf8(string_view{text}.substr(0UL, text.size() - 3UL)), string_view::npos);
+    ASSERT_EQ(findInvalidUtf8(string_view{text}.substr(0UL, 3UL)), 2UL);
+}
+
+TEST_F(Utf8Test, util_utf8_validation_matches_decoder_test)
+{
+    // reference: decode character by character
+    auto const validPrefix = [](string const &str) {
+        auto const *const bytes = reinterpret_cast<unsigned char const *>(str.data());
+        size_t            i     = 0UL;
+        while (i < str.size())
+        {
+            auto const length = decodeUtf8(bytes + i, str.size() - i).length;
+            if (length == 0UL)
+            {
+                return i;
+            }
+            i += length;
+        }
+        return string::npos;
+    };
+
+    // all pairs of bytes, followed by continuation bytes or ASCII, at a position that straddles the block boundaries
+    for (unsigned first = 0U; first < 256U; first++)
+    {
+        for (unsigned second = 0U; second < 256U; second++)
+        {
+            auto source = string(29UL + (first + second) % 8UL, 'x');
+            source += static_cast<char>(first);
+            source += static_cast<char>(second);
+            source += second % 2U == 0U ? "\x80\x80 tail" : "\xBF tail";
+            ASSERT_EQ(findInvalidUtf8(source), validPrefix(source)) << "bytes " << first << " " << second;
+        }
+    }
+
+    // mostly valid text of all encoded lengths, with a random byte replaced
+    vector<string> const characters{"a", "Z", " ", "ä", "ß", "€", "漢", "𝄞", "🎉", encoded(0x10'FFFFU)};
+
+    uint32_t   state  = 12'345U;
+    auto const random = [&state]() {
+        state = state * 1'103'515'245U + 12'345U;
+        return state >> 8U;
+    };
+    for (size_t round = 0UL; round < 2'000UL; round++)
+    {
+        string source;
+        while (source.size() < round % 300UL)
+        {
+            source += characters[random() % characters.size()];
+        }
+        if (round % 3UL != 0UL && !source.empty())
+        {
+            source[random() % source.size()] = static_cast<char>(random());
+        }
+        ASSERT_EQ(findInvalidUtf8(source), validPrefix(source)) << "round " << round;
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   test/view_hash_set_tests.cc
+ * Description: Unit tests for the hash set of string-views and the view-collecting splits.
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+#include "ci_string.h"
+#include "stringutil.h"
+#include "view_hash_set.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace util;
+
+class ViewHashSetTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // just in case
+    }
+
+    void TearDown() override
+    {
+        // just in case
+    }
+};
+
+TEST_F(ViewHashSetTest, insert_and_contains)
+{
+    ViewHashSet<char> set;
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains("a"));
+
+    vector<string> tokens;
+    for (size_t i = 0UL; i < 1'000UL; i++)
+    {
+        tokens.emplace_back("token" + to_string(i));
+    }
+    for (auto const &token: tokens)
+    {
+        ASSERT_TRUE(set.insert(token));
+    }
+    // inserting equal views again does not add them, whatever they point to
+    for (auto const &token: tokens)
+    {
+        ASSERT_FALSE(set.insert(string{token}));
+    }
+    ASSERT_EQ(set.size(), 1'000UL);
+    for (auto const &token: tokens)
+    {
+        ASSERT_TRUE(set.contains(token));
+    }
+    ASSERT_FALSE(set.contains("token1000"));
+    ASSERT_FALSE(set.contains(""));
+    ASSERT_TRUE(set.insert(""));
+    ASSERT_TRUE(set.contains(string_view{}));
+
+    size_t count = 0UL;
+    for (auto token: set.values())
+    {
+        ASSERT_TRUE(token.empty() || token.starts_with("token"));
+        count++;
+    }
+    ASSERT_EQ(count, set.size());
+
+    ViewHashSet<char> reserved;
+    reserved.reserve(100UL);
+    ASSERT_TRUE(reserved.insert("x"));
+    ASSERT_EQ(reserved.size(), 1UL);
+}
+
+TEST_F(ViewHashSetTest, case_insensitive_views)
+{
+    ViewHashSet<char, ci_char_traits<char>> set;
+    ASSERT_TRUE(set.insert("Content-Type"));
+    ASSERT_FALSE(set.insert("content-type"));
+    ASSERT_TRUE(set.contains("CONTENT-TYPE"));
+    ASSERT_FALSE(set.contains("content-length"));
+    ASSERT_EQ(set.size(), 1UL);
+}
+
+TEST_F(ViewHashSetTest, split_alternatives_to_split_into_set)
+{
+    string const tags = "prod,eu-west,web,prod,,canary,web,eu-west";
+
+    auto const nodeSet   = splitIntoSet(tags, ',');
+    auto const hashSet   = splitIntoHashSet(tags, ',');
+    auto const flatViews = splitIntoSortedViews(tags, ',');
+
+    ASSERT_EQ(hashSet.size(), nodeSet.size());
+    ASSERT_EQ(flatViews.size(), nodeSet.size());
+    ASSERT_TRUE(std::ranges::equal(flatViews, nodeSet));
+    for (auto const &tag: nodeSet)
+    {
+        ASSERT_TRUE(hashSet.contains(tag));
+        ASSERT_TRUE(std::ranges::binary_search(flatViews, string_view{tag}));
+    }
+    ASSERT_FALSE(hashSet.contains("staging"));
+    ASSERT_FALSE(std::ranges::binary_search(flatViews, string_view{"staging"}));
+
+    // the results are views into the original string
+    for (auto view: flatViews)
+    {
+        ASSERT_GE(view.data(), tags.data());
+        ASSERT_LE(view.data() + view.size(), tags.data() + tags.size());
+    }
+
+    // string separators, and a separator that does not occur
+    ASSERT_EQ(splitIntoSortedViews(string_view{"b::a::b"}, "::"), (vector<string_view>{"a", "b"}));
+    ASSERT_EQ(splitIntoHashSet(string_view{"abc"}, ';').size(), 1UL);
+
+    // case-insensitive strings keep the first of equal tokens
+    ci_string const ciTags{"Web,PROD,web,prod"};
+    auto const      ciViews = splitIntoSortedViews(ciTags, ',');
+    ASSERT_EQ(ciViews.size(), 2UL);
+    ASSERT_EQ(string_view(ciViews[0].data(), ciViews[0].size()), "PROD");
+    ASSERT_EQ(string_view(ciViews[1].data(), ciViews[1].size()), "Web");
+    ASSERT_TRUE(splitIntoHashSet(ciTags, ',').contains("WEB"));
+}
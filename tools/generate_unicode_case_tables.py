@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+#
+# Repository:  https://github.com/kingkybel/StringUtilities
+# File Name:   tools/generate_unicode_case_tables.py
+# Description: generate include/unicode_case_tables.h from the Unicode database of the running Python
+#
+# Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+#
+# @date: 2026-10-16
+# @author: Dieter J Kybelksties
+"""
+Generate the simple (one-to-one) Unicode case mappings as ranges of code points sharing the same delta.
+
+Usage: tools/generate_unicode_case_tables.py > include/unicode_case_tables.h
+
+The tables follow the Unicode version of the running Python's unicodedata (unicodedata.unidata_version), which is
+recorded in the generated header. To regenerate the tables without changing the mappings, use a Python that carries
+the same Unicode version as the current header; a different Python upgrades (or downgrades) the tables.
+"""
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+SURROGATES = range(0xD800, 0xE000)
+
+
+def simple_mapping(cp, full, title):
+    """The simple case mapping of cp, derived from Python's full mapping: where the full mapping expands to several
+    code points, the simple mapping is the single-code-point titlecase (Greek iota-subscript letters), the one
+    special lower-case mapping of U+0130, or cp itself."""
+    mapped = full(chr(cp))
+    if len(mapped) == 1:
+        return ord(mapped)
+    if cp == 0x0130:
+        return 0x0069
+    titled = title(chr(cp))
+    if len(titled) == 1 and full is str.upper:
+        return ord(titled)
+    return cp
+
+
+def mappings(full):
+    reval = {}
+    for cp in range(MAX_CODE_POINT + 1):
+        if cp in SURROGATES:
+            continue
+        mapped = simple_mapping(cp, full, str.title)
+        if mapped != cp:
+            reval[cp] = mapped
+    return reval
+
+
+def ranges(mapping):
+    """Compact the mapping into (first, last, delta, stride) ranges, stride 2 covering alternating case pairs."""
+    reval = []
+    cps = sorted(mapping)
+    i = 0
+    while i < len(cps):
+        first = cps[i]
+        delta = mapping[first] - first
+        last = first
+        stride = 1
+        if mapping.get(first + 1, None) == first + 1 + delta:
+            while mapping.get(last + 1, None) == last + 1 + delta:
+                last += 1
+        elif mapping.get(first + 2, None) == first + 2 + delta and first + 1 not in mapping:
+            stride = 2
+            while mapping.get(last + 2, None) == last + 2 + delta and last + 1 not in mapping:
+                last += 2
+        reval.append((first, last, delta, stride))
+        i = cps.index(last, i) + 1
+    return reval
+
+
+def table(name, mapping_ranges):
+    lines = [f"inline constexpr std::array<CaseRange, {len(mapping_ranges)}UL> {name}{{{{"]
+    for first, last, delta, stride in mapping_ranges:
+        lines.append(f"    {{0x{first:05X}, 0x{last:05X}, {delta}, {stride}}},")
+    lines.append("}};")
+    return "\n".join(lines)
+
+
+HEADER = """/*
+ * Repository:  https://github.com/kingkybel/StringUtilities
+ * File Name:   include/unicode_case_tables.h
+ * Description: simple Unicode case mappings, generated by tools/generate_unicode_case_tables.py
+ *
+ * Copyright (C) 2026 Dieter J Kybelksties <github@kybelksties.com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ *
+ * @date: 2026-10-16
+ * @author: Dieter J Kybelksties
+ */
+
+// Generated from Unicode {version}, do not edit.
+
+#ifndef NS_UTIL_UNICODE_CASE_TABLES_H_INCLUDED
+#define NS_UTIL_UNICODE_CASE_TABLES_H_INCLUDED
+
+#include <array>
+#include <cstdint>
+
+namespace util::detail
+{{
+/**
+ * @brief A range of code points with the same simple case mapping: every stride-th code point from first to last
+ *        maps to itself plus delta.
+ */
+struct CaseRange
+{{
+    char32_t first;  ///< first code point of the range
+    char32_t last;   ///< last code point of the range
+    int32_t  delta;  ///< mapped minus original code point
+    uint32_t stride; ///< 1 if all code points of the range are mapped, 2 if every other one is
+}};
+
+/**
+ * @brief Simple lower-case mappings, sorted by code point.
+ */
+{lower}
+
+/**
+ * @brief Simple upper-case mappings, sorted by code point.
+ */
+{upper}
+}} // namespace util::detail
+
+#endif // NS_UTIL_UNICODE_CASE_TABLES_H_INCLUDED
+"""
+
+if __name__ == "__main__":
+    sys.stdout.write(
+        HEADER.format(
+            version=unicodedata.unidata_version,
+            lower=table("LOWER_CASE_RANGES", ranges(mappings(str.lower))),
+            upper=table("UPPER_CASE_RANGES", ranges(mappings(str.upper))),
+        )
+    )